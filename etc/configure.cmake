@@ -96,6 +96,26 @@ if (HAVE_GCRYPT_H)
   option(HAVE_GCRY_MD_HD_T "libgcrypt HAVE_GCRY_MD_HD_T" ON)
 endif (HAVE_GCRYPT_H)
 
+# Compression libraries, for compressed output files
+check_include_files(zlib.h HAVE_ZLIB_H)
+if (HAVE_ZLIB_H)
+  find_library(LIB_Z NAMES z)
+  if (LIB_Z)
+    option(HAVE_LIBZ "zlib" ON)
+  endif (LIB_Z)
+endif (HAVE_ZLIB_H)
+
+check_include_files(zstd.h HAVE_ZSTD_H)
+if (HAVE_ZSTD_H)
+  find_library(LIB_ZSTD NAMES zstd)
+  if (LIB_ZSTD)
+    option(HAVE_LIBZSTD "libzstd" ON)
+  endif (LIB_ZSTD)
+endif (HAVE_ZSTD_H)
+
+# Thread library, for multithreaded compression and checksums
+find_package(Threads REQUIRED)
+
 # ps2pdf used in building the PDF version of the documentation
 find_program(PS2PDF ps2pdf)
 if(WIN32)
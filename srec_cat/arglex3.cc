@@ -36,9 +36,11 @@ srec_cat_arglex3::srec_cat_arglex3(int argc, char **argv) :
         { "-Line_LENGth", token_line_length, },
         { "-Line_Termination", token_line_termination, },
         { "-End_Of_Line", token_line_termination, },
+        { "-MERge", token_merge, },
         { "-Output_Block_Size", token_output_block_size, },
         { "-Output_Block_Packing", token_output_block_packing, },
         { "-Output_Block_Alignment", token_output_block_align, },
+        { "-Output_COMPression", token_output_compression, },
 
         //
         // This option is intentionally undocumented.  It is preserved
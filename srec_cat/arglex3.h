@@ -40,6 +40,8 @@ class srec_cat_arglex3:
         token_output_block_size,
         token_output_block_packing,
         token_output_block_align,
+        token_output_compression,
+        token_merge,
         token_MAX
     };
 
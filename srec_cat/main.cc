@@ -18,14 +18,16 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <vector>
 
 #include <srecord/input/catenate.h>
 #include <srecord/input/file.h>
+#include <srecord/input/merge.h>
 #include <srecord/memory.h>
+#include <srecord/memory/walker/reblock.h>
 #include <srecord/memory/walker/writer.h>
 #include <srecord/output.h>
 #include <srecord/output/file.h>
-#include <srecord/output/filter/reblock.h>
 #include <srecord/record.h>
 #include <srecord/string.h>
 
@@ -37,7 +39,8 @@ main(int argc, char **argv)
 {
     srec_cat_arglex3 cmdline(argc, argv);
     cmdline.token_first();
-    srecord::input::pointer infile;
+    std::vector<srecord::input::pointer> infiles;
+    bool merge = false;
     srecord::output::pointer outfile;
     int line_length = 0;
     int address_length = 0;
@@ -60,13 +63,7 @@ main(int argc, char **argv)
         case srecord::arglex_tool::token_string:
         case srecord::arglex_tool::token_stdio:
         case srecord::arglex_tool::token_generator:
-            {
-                srecord::input::pointer ip = cmdline.get_input();
-                if (infile)
-                    infile = srecord::input_catenate::create(infile, ip);
-                else
-                    infile = ip;
-            }
+            infiles.push_back(cmdline.get_input());
             continue;
 
         case srecord::arglex_tool::token_output:
@@ -204,30 +201,37 @@ main(int argc, char **argv)
         case srec_cat_arglex3::token_output_block_align:
             output_block_align = true;
             break;
+
+        case srec_cat_arglex3::token_merge:
+            merge = true;
+            break;
+
+        case srec_cat_arglex3::token_output_compression:
+            {
+                int tok = cmdline.token_cur();
+                cmdline.token_next();
+                std::string name = cmdline.get_string(cmdline.token_name(tok));
+                if (!srecord::output_file::compression_by_name(name))
+                {
+                    std::cerr << "compression \"" << name << "\" unknown"
+                        << std::endl;
+                    cmdline.usage();
+                }
+            }
+            continue;
         }
         cmdline.token_next();
     }
-    if (!infile)
-        infile = cmdline.get_input();
+    if (infiles.empty())
+        infiles.push_back(cmdline.get_input());
+    srecord::input::pointer infile = infiles[0];
+    if (merge)
+        infile = srecord::input_merge::create(infiles);
+    else if (infiles.size() > 1)
+        infile = srecord::input_catenate::create(infiles);
     if (!outfile)
         outfile = cmdline.get_output();
 
-    if (output_block_packing || output_block_align)
-    {
-        //
-        // Reblock the output so that it matches the output file's block
-        // size exactly.  That way SRecord's internal memory chunk size
-        // does not cause output artifacts.  This requires lost of
-        // memory copying back and forth, so only do it if they asked
-        // for it.
-        //
-        // This filter makes no semantic difference to the output.
-        // (If it does, it's a bug.)
-        //
-        outfile =
-            srecord::output_filter_reblock::create(outfile, output_block_align);
-    }
-
     if (address_length > 0)
         outfile->address_length_set(address_length);
     if (line_length > 0)
@@ -274,6 +278,25 @@ main(int argc, char **argv)
     //
     srecord::memory_walker::pointer w =
         srecord::memory_walker_writer::create(outfile);
+    if (output_block_packing || output_block_align)
+    {
+        //
+        // Reblock the output so that it matches the output file's block
+        // size exactly.  That way SRecord's internal memory chunk size
+        // does not cause output artifacts.  Only blocks which straddle
+        // a memory chunk boundary need to be copied.
+        //
+        // This makes no semantic difference to the output.
+        // (If it does, it's a bug.)
+        //
+        w =
+            srecord::memory_walker_reblock::create
+            (
+                w,
+                outfile->preferred_block_size_get(),
+                output_block_align
+            );
+    }
     m.walk(w);
 
     //
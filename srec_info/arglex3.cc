@@ -0,0 +1,33 @@
+//
+//      srecord - manipulate eprom load files
+//      Copyright (C) 2026 Scott Finneran
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program. If not, see
+//      <http://www.gnu.org/licenses/>.
+//
+
+#include <srec_info/arglex3.h>
+
+
+srec_info_arglex3::srec_info_arglex3(int argc, char **argv) :
+    arglex_tool(argc, argv)
+{
+    static const table_ty table[] =
+    {
+        { "-DIGest", token_digest, },
+        SRECORD_ARGLEX_END_MARKER
+    };
+
+    table_set(table);
+}
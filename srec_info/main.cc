@@ -24,22 +24,52 @@
 #include <iostream>
 #include <vector>
 
+#include <srec_info/arglex3.h>
 #include <srecord/interval.h>
-#include <srecord/arglex/tool.h>
+#include <srecord/interval/builder.h>
 #include <srecord/input/file.h>
 #include <srecord/memory.h>
+#include <srecord/memory/walker/multi.h>
+#include <srecord/named_digest.h>
 #include <srecord/record.h>
 #include <srecord/string.h>
 
 
+typedef std::vector<srecord::named_digest::pointer> digests_t;
+
+
+/**
+  * The report_digests function is used to calculate all of the
+  * requested checksums and message digests of the data, in a single
+  * pass, and print them.
+  */
+static void
+report_digests(const srecord::memory &data, const digests_t &digests)
+{
+    if (digests.empty())
+        return;
+    srecord::memory_walker_multi::pointer w =
+        srecord::memory_walker_multi::create();
+    for (const srecord::named_digest::pointer &dp : digests)
+        w->push_back(dp->start());
+    data.walk_parallel(w);
+    for (const srecord::named_digest::pointer &dp : digests)
+    {
+        std::cout << dp->get_name() << ": " << dp->get_result()
+            << std::endl;
+    }
+}
+
+
 int
 main(int argc, char **argv)
 {
-    srecord::arglex_tool cmdline(argc, argv);
+    srec_info_arglex3 cmdline(argc, argv);
     cmdline.token_first();
     typedef std::vector<srecord::input::pointer> infile_t;
     infile_t infile;
     bool verbose = false;
+    digests_t digests;
 
     while (cmdline.token_cur() != srecord::arglex::token_eoln)
     {
@@ -59,6 +89,19 @@ main(int argc, char **argv)
         case srecord::arglex::token_verbose:
             verbose = true;
             break;
+
+        case srec_info_arglex3::token_digest:
+            if (cmdline.token_next() != srecord::arglex::token_string)
+            {
+                std::cerr << "the -digest option requires a name"
+                    << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            digests.push_back
+            (
+                srecord::named_digest::create(cmdline.value_string().c_str())
+            );
+            break;
         }
         cmdline.token_next();
     }
@@ -82,7 +125,8 @@ main(int argc, char **argv)
             << srecord::string_url_encode(ifp->get_file_format_name())
             << std::endl;
         srecord::record record;
-        srecord::interval range;
+        srecord::interval_builder builder;
+        srecord::memory data;
         while (ifp->read(record))
         {
             switch (record.get_type())
@@ -102,12 +146,21 @@ main(int argc, char **argv)
                 break;
 
             case srecord::record::type_data:
-                range +=
-                    srecord::interval
+                builder.add
+                (
+                    record.get_address(),
+                    record.get_address() + record.get_length()
+                );
+                if (!digests.empty())
+                {
+                    data.add_record
                     (
-                        record.get_address(),
-                        record.get_address() + record.get_length()
+                        ifp,
+                        record,
+                        srecord::defcon_ignore,
+                        srecord::defcon_warning
                     );
+                }
                 break;
 
             case srecord::record::type_execution_start_address:
@@ -125,9 +178,11 @@ main(int argc, char **argv)
                 break;
             }
         }
+        const srecord::interval range = builder.build();
         if (range.empty())
         {
             std::cout << "Data:   none" << std::endl;
+            report_digests(data, digests);
             continue;
         }
 
@@ -141,22 +196,16 @@ main(int argc, char **argv)
         std::cout << std::setfill('0');
 
         uint32_t number_bytes = 0UL;
-        bool first_line = true;
-        for (;;)
+        std::vector<srecord::interval::data_t> runs;
+        range.get_runs(runs);
+        for (size_t j = 0; j < runs.size(); j += 2)
         {
-            srecord::interval tmp = range;
-            tmp.first_interval_only();
-            if (first_line)
-            {
+            if (j == 0)
                 std::cout << "Data:   ";
-                first_line = false;
-            }
             else
-            {
                 std::cout << "        ";
-            }
-            const uint32_t lo = tmp.get_lowest();
-            const uint32_t hi = tmp.get_highest();
+            const uint32_t lo = runs[j];
+            const uint32_t hi = runs[j + 1];
             const auto hi_address = static_cast<uint32_t>(hi - 1U);
             std::cout
                 << std::setw(prec) << lo
@@ -170,9 +219,6 @@ main(int argc, char **argv)
             std::cout << std::endl;
 
             number_bytes += interval_size;
-            range -= tmp;
-            if (range.empty())
-                break;
         }
 
         if (verbose)
@@ -203,6 +249,7 @@ main(int argc, char **argv)
                 << ((1.0 - alloc_ratio) * 100.0) << "%"
                 << std::endl;
         }
+        report_digests(data, digests);
     }
 
     //
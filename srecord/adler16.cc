@@ -17,6 +17,7 @@
 //
 
 #include <srecord/adler16.h>
+#include <srecord/byte_sums.h>
 
 uint16_t
 srecord::adler16::get()
@@ -38,11 +39,41 @@ srecord::adler16::next(uint8_t c)
 void
 srecord::adler16::nextbuf(const void *data, size_t nbytes)
 {
+    //
+    // Work a block at a time, and only reduce modulo 251 at the
+    // end of each block.  See byte_sums.h for how the two sums are
+    // worked out.
+    //
     const auto *dp = (const uint8_t *)data;
     while (nbytes > 0)
     {
-        next(*dp);
-        ++dp;
-        --nbytes;
+        size_t n = (nbytes < byte_sums_max ? nbytes : byte_sums_max);
+        uint32_t sum;
+        uint32_t weighted;
+        byte_sums(dp, n, sum, weighted);
+        uint64_t b = sum_b + (uint64_t)n * sum_a + weighted;
+        sum_a = (sum_a + sum) % 251;
+        sum_b = b % 251;
+        dp += n;
+        nbytes -= n;
     }
 }
+
+
+void
+srecord::adler16::clear()
+{
+    sum_a = 0;
+    sum_b = 0;
+}
+
+
+void
+srecord::adler16::combine(const adler16 &later, size_t nbytes)
+{
+    // The later sum_b counts each of its bytes once too few times for
+    // every byte seen before, which sum_a times nbytes makes up.
+    uint64_t b = sum_b + (uint64_t)(nbytes % 251) * sum_a + later.sum_b;
+    sum_a = (sum_a + later.sum_a) % 251;
+    sum_b = b % 251;
+}
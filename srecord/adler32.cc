@@ -17,6 +17,7 @@
 //
 
 #include <srecord/adler32.h>
+#include <srecord/byte_sums.h>
 
 uint32_t
 srecord::adler32::get()
@@ -29,20 +30,56 @@ srecord::adler32::get()
 void
 srecord::adler32::next(uint8_t c)
 {
-    // This is not portable to int=16-bit machines
-    sum_a = (sum_a + c) % 65521;
-    sum_b = (sum_b + sum_a) % 65521;
+    // Both sums are already reduced, so a subtraction will do.
+    unsigned a = sum_a + c;
+    if (a >= 65521)
+        a -= 65521;
+    unsigned b = sum_b + a;
+    if (b >= 65521)
+        b -= 65521;
+    sum_a = a;
+    sum_b = b;
 }
 
 
 void
 srecord::adler32::nextbuf(const void *data, size_t nbytes)
 {
-    const auto *dp = (const uint8_t *)(data);
+    //
+    // Work a block at a time, and only reduce modulo 65521 at the
+    // end of each block.  See byte_sums.h for how the two sums are
+    // worked out.
+    //
+    const auto *dp = (const uint8_t *)data;
     while (nbytes > 0)
     {
-        next(*dp);
-        ++dp;
-        --nbytes;
+        size_t n = (nbytes < byte_sums_max ? nbytes : byte_sums_max);
+        uint32_t sum;
+        uint32_t weighted;
+        byte_sums(dp, n, sum, weighted);
+        uint64_t b = sum_b + (uint64_t)n * sum_a + weighted;
+        sum_a = (sum_a + sum) % 65521;
+        sum_b = b % 65521;
+        dp += n;
+        nbytes -= n;
     }
 }
+
+
+void
+srecord::adler32::clear()
+{
+    sum_a = 0;
+    sum_b = 0;
+}
+
+
+void
+srecord::adler32::combine(const adler32 &later, size_t nbytes)
+{
+    // The later sum_b counts each of its bytes once too few times for
+    // every byte seen before, which sum_a times nbytes makes up.
+    uint64_t b = sum_b + (uint64_t)(nbytes % 65521) * sum_a + later.sum_b;
+    sum_a = (sum_a + later.sum_a) % 65521;
+    sum_b = b % 65521;
+}
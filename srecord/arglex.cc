@@ -421,6 +421,12 @@ srecord::arglex::token_next()
     const table_ty  *hit[20];
     int             nhit;
 
+    if (token_log)
+    {
+        *token_log += value_string_;
+        *token_log += '\0';
+    }
+
     std::string arg;
     if (!pushback.empty())
     {
@@ -233,6 +233,13 @@ class arglex
       */
     std::list<std::string> pushback;
 
+    /**
+      * The token_log instance variable is used to remember where to
+      * record the text of each token consumed, or NULL if tokens are
+      * not being recorded.  See #token_record for more information.
+      */
+    std::string *token_log{nullptr};
+
 protected:
     /**
       * The table_set method is used to append more command line
@@ -256,6 +263,17 @@ class arglex
       */
     int token_next();
 
+    /**
+      * The token_record method is used to record the text of each
+      * token as it is consumed by #token_next, NUL terminated.  This
+      * gives a canonical spelling of a stretch of the command line,
+      * suitable for use as a key.
+      *
+      * @param log
+      *     Where to append the tokens, or NULL to stop recording.
+      */
+    void token_record(std::string *log) { token_log = log; }
+
     /**
       * The token_first method is used to fetch the first command
       * like token (rather than use the token_next method).  This does
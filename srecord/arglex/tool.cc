@@ -82,11 +82,14 @@ srecord::arglex_tool::arglex_tool(int argc, char **argv) :
         { "-Cyclic_Redundancy_Check_16_XMODEM", token_crc16_xmodem,},
         { "-Cyclic_Redundancy_Check_32_Big_Endian", token_crc32_be, },
         { "-Cyclic_Redundancy_Check_32_Little_Endian", token_crc32_le,},
+        { "-Cyclic_Redundancy_Check_Big_Endian", token_crc_be, },
+        { "-Cyclic_Redundancy_Check_Little_Endian", token_crc_le, },
         { "-C_Array", token_c_array, },
         { "-C_COMpressed", token_c_compressed, },
         { "-DECimal_STyle", token_style_hexadecimal_not, },
         { "-Dec_Binary", token_dec_binary, },
         { "-DIFference", token_minus, },
+        { "-DIGESTS", token_digests, },
         { "-Disable_Sequence_Warnings", token_sequence_warnings_disable, },
         { "-Dot_STyle", token_style_dot, },
         { "-EEPROM", token_eeprom, },
@@ -107,6 +110,7 @@ srecord::arglex_tool::arglex_tool(int argc, char **argv) :
         { "-FAIrchild", token_fairchild, },
         { "-Fast_Load", token_fast_load, },
         { "-Fill", token_fill, },
+        { "-Filter_Plan", token_filter_plan, },
         { "-Fletchers_16_Big_Endian", token_fletcher16_be, },
         { "-Fletchers_16_Little_Endian", token_fletcher16_le, },
         { "-Fletchers_32_Big_Endian", token_fletcher32_be, },
@@ -128,6 +132,7 @@ srecord::arglex_tool::arglex_tool(int argc, char **argv) :
         { "-HP64k", token_hp64k, },
         { "-IGnore_Checksums", token_ignore_checksums, },
         { "-INCLude", token_include, },
+        { "-INITial", token_crc_initial, },
         { "-Integrated_Device_Technology", token_idt, },
         { "-Intel", token_intel, },
         { "-INtel_HeXadecimal_16", token_intel16, },
@@ -151,6 +156,7 @@ srecord::arglex_tool::arglex_tool(int argc, char **argv) :
         { "-MInimum_Big_Endian",token_minimum_be, },
         { "-MInimum_Little_Endian", token_minimum_le, },
         { "-MINUs", token_minus, },
+        { "-MODel", token_crc_model, },
         { "-Mips_Flash_Big_Endian", token_mips_flash_be, },
         { "-Mips_Flash_Little_Endian", token_mips_flash_le, },
         { "-Most_To_Least", token_crc16_most_to_least },
@@ -183,6 +189,8 @@ srecord::arglex_tool::arglex_tool(int argc, char **argv) :
         { "-RAnge_PADding", token_range_padding, },
         { "-RAw", token_binary, },
         { "-Redundant_Bytes", token_redundant_bytes },
+        { "-REFlect_In", token_crc_reflect_in, },
+        { "-REFlect_Out", token_crc_reflect_out, },
         { "-REPeat_Data", token_repeat_data, },
         { "-REPeat_String", token_repeat_string, },
         { "-Ripe_Message_Digest_160", token_rmd160 },
@@ -226,10 +234,12 @@ srecord::arglex_tool::arglex_tool(int argc, char **argv) :
         { "-VHdl_Textio", token_vhdl_textio, },
         { "-VMem", token_vmem, },
         { "-WHIrlpool", token_whirlpool },
+        { "-WIDth", token_crc_width, },
         { "-WILson", token_wilson, },
         { "-Within", token_within, },
         { "-Xilinx_Coefficient_File", token_xilinx_coefficient_file },
         { "-XOR", token_xor, },
+        { "-XOR_Out", token_crc_xor_out, },
         { "-X_MODEM", token_crc16_xmodem, },
         { "[", token_paren_begin, },
         { "]", token_paren_end, },
@@ -371,6 +381,11 @@ srecord::arglex_tool::default_command_line_processing()
         token_next();
         break;
 
+    case token_filter_plan:
+        show_filter_plan = true;
+        token_next();
+        break;
+
     case token_multiple:
         // This one is intentionally not documented.
         // Use one of the -rb or -cb options.
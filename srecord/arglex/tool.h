@@ -20,10 +20,14 @@
 #ifndef SRECORD_ARGLEX_TOOL_H
 #define SRECORD_ARGLEX_TOOL_H
 
+#include <map>
+#include <string>
+
 #include <srecord/arglex.h>
 #include <srecord/defcon.h>
 #include <srecord/endian.h>
 #include <srecord/input.h>
+#include <srecord/input/cache.h>
 #include <srecord/output.h>
 
 
@@ -85,8 +89,17 @@ class arglex_tool:
         token_crc16_xmodem,
         token_crc32_be,
         token_crc32_le,
+        token_crc_be,
+        token_crc_initial,
+        token_crc_le,
+        token_crc_model,
+        token_crc_reflect_in,
+        token_crc_reflect_out,
+        token_crc_width,
+        token_crc_xor_out,
         token_crop,
         token_dec_binary,
+        token_digests,
         token_eeprom,
         token_efinix_bit,
         token_emon52,
@@ -103,6 +116,7 @@ class arglex_tool:
         token_fairchild,
         token_fast_load,
         token_fill,
+        token_filter_plan,
         token_fletcher16_be,
         token_fletcher16_le,
         token_fletcher32_be,
@@ -382,6 +396,15 @@ class arglex_tool:
       */
     bool stdin_used{false};
 
+    /**
+      * The input_stores instance variable is used to remember the
+      * input files named so far, keyed on the file name and format
+      * options, so that a file named more than once on the command line
+      * (say, as an input and again for -over or -maximum-address) is
+      * only parsed once.
+      */
+    std::map<std::string, std::weak_ptr<input_cache::store>> input_stores;
+
     /**
       * The stdout_used instance variable is used to remember whether
       * or not the standard output has been used by a filter, yet.
@@ -401,6 +424,13 @@ class arglex_tool:
       */
     int issue_sequence_warnings{-1};
 
+    /**
+      * The show_filter_plan instance variable is used to remember
+      * whether or not to print each input's filter chain, after the
+      * optimiser has fused what it can, on the standard error.
+      */
+    bool show_filter_plan{false};
+
     /**
       * The get_simple_input method is used to parse an input filename
       * or generator from the command line.  It shall only be used by
@@ -18,9 +18,12 @@
 //
 
 #include <iostream>
+#include <vector>
 
+#include <srecord/progname.h>
 #include <srecord/quit.h>
 #include <srecord/arglex/tool.h>
+#include <srecord/input/cache.h>
 #include <srecord/input/catenate.h>
 #include <srecord/input/file/aomf.h>
 #include <srecord/input/file/ascii_hex.h>
@@ -72,6 +75,7 @@
 #include <srecord/input/filter/checksum/positive.h>
 #include <srecord/input/filter/crop.h>
 #include <srecord/input/filter/fill.h>
+#include <srecord/input/filter/fused.h>
 #include <srecord/input/filter/interval/length.h>
 #include <srecord/input/filter/interval/maximum.h>
 #include <srecord/input/filter/interval/minimum.h>
@@ -79,10 +83,13 @@
 #include <srecord/input/filter/message/adler32.h>
 #include <srecord/input/filter/message/crc16.h>
 #include <srecord/input/filter/message/crc32.h>
+#include <srecord/input/filter/message/crc_rocksoft.h>
 #include <srecord/input/filter/message/stm32.h>
 #include <srecord/input/filter/message/fletcher16.h>
 #include <srecord/input/filter/message/fletcher32.h>
+#include <srecord/input/filter/message/digest.h>
 #include <srecord/input/filter/message/gcrypt.h>
+#include <srecord/input/filter/message/multi.h>
 #include <srecord/input/filter/nibble_swap.h>
 #include <srecord/input/filter/not.h>
 #include <srecord/input/filter/offset.h>
@@ -111,6 +118,7 @@ srecord::arglex_tool::get_endian_by_token(int tok)
     case token_checksum_be_positive:
     case token_crc16_be:
     case token_crc32_be:
+    case token_crc_be:
     case token_exclusive_length_be:
     case token_exclusive_maximum_be:
     case token_exclusive_minimum_be:
@@ -133,6 +141,7 @@ srecord::arglex_tool::get_endian_by_token(int tok)
     case token_checksum_le_positive:
     case token_crc16_le:
     case token_crc32_le:
+    case token_crc_le:
     case token_exclusive_length_le:
     case token_exclusive_maximum_le:
     case token_exclusive_minimum_le:
@@ -211,7 +220,8 @@ srecord::arglex_tool::get_simple_input()
     case token_paren_begin:
         {
             token_next();
-            input::pointer ifp = get_input();
+            std::vector<input::pointer> inputs;
+            inputs.push_back(get_input());
             for (;;)
             {
                 switch (token_cur())
@@ -220,12 +230,14 @@ srecord::arglex_tool::get_simple_input()
                 case arglex_tool::token_string:
                 case arglex_tool::token_stdio:
                 case arglex_tool::token_generator:
-                    ifp = input_catenate::create(ifp, get_input());
+                    inputs.push_back(get_input());
                     break;
 
                 case token_paren_end:
                     token_next();
-                    return ifp;
+                    if (inputs.size() == 1)
+                        return inputs[0];
+                    return input_catenate::create(inputs);
 
                 default:
                     fatal_error
@@ -266,6 +278,14 @@ srecord::arglex_tool::get_simple_input()
         break;
     }
 
+    //
+    // Remember how the file was named, so that it need only be parsed
+    // once no matter how many times it is used.
+    //
+    std::string key = fn;
+    key += '\0';
+    token_record(&key);
+
     //
     // determine the file format
     // and open the input file
@@ -517,6 +537,24 @@ srecord::arglex_tool::get_simple_input()
         ifp->disable_checksum_validation();
         token_next();
     }
+    token_record(nullptr);
+
+    //
+    // Share the records with any other use of the same file.
+    // The standard input can only be named once, so it is left alone.
+    //
+    if (fn != "-")
+    {
+        input_cache::store_pointer sp = input_stores[key].lock();
+        if (sp && sp->shareable())
+            ifp = input_cache::create(sp);
+        else
+        {
+            ifp = input_cache::create(ifp);
+            input_stores[key] =
+                std::static_pointer_cast<input_cache>(ifp)->get_store();
+        }
+    }
 
     //
     // warn about data record sequences, if asked to
@@ -700,11 +738,52 @@ srecord::arglex_tool::get_input()
             }
             break;
 
+        case token_crc_be:
+        case token_crc_le:
+            {
+                const char *name = token_name();
+                endian_t end = get_endian_by_token();
+                token_next();
+                uint32_t address;
+                get_address(name, address);
+                ifp =
+                    input_filter_message_crc_rocksoft::create
+                    (
+                        ifp,
+                        address,
+                        end
+                    );
+            }
+            break;
+
         case token_crop:
             token_next();
             ifp = input_filter_crop::create(ifp, get_interval("-Crop"));
             break;
 
+        case token_digests:
+            {
+                const char *name = token_name();
+                token_next();
+                uint32_t address;
+                get_address(name, address);
+                std::string names = get_string(name);
+                input_filter_message_multi::digests_t digests;
+                for (size_t pos = 0; pos <= names.size(); )
+                {
+                    size_t comma = names.find(',', pos);
+                    if (comma == std::string::npos)
+                        comma = names.size();
+                    std::string one = names.substr(pos, comma - pos);
+                    if (one.empty())
+                        fatal_error("%s: empty digest name", name);
+                    digests.push_back(named_digest::create(one.c_str()));
+                    pos = comma + 1;
+                }
+                ifp = input_filter_message_multi::create(ifp, address, digests);
+            }
+            break;
+
         case token_exclude:
             token_next();
             ifp = input_filter_crop::create(ifp, -get_interval("-Exclude"));
@@ -909,7 +988,13 @@ srecord::arglex_tool::get_input()
                 token_next();
                 uint32_t address = 0;
                 get_address(name, address);
-                ifp = input_filter_message_gcrypt::create_md5(ifp, address);
+                ifp =
+                    input_filter_message_digest::create
+                    (
+                        ifp,
+                        address,
+                        "MD5"
+                    );
             }
             break;
 
@@ -968,7 +1053,13 @@ srecord::arglex_tool::get_input()
                 token_next();
                 uint32_t address = 0;
                 get_address(name, address);
-                ifp = input_filter_message_gcrypt::create_sha1(ifp, address);
+                ifp =
+                    input_filter_message_digest::create
+                    (
+                        ifp,
+                        address,
+                        "SHA1"
+                    );
             }
             break;
 
@@ -979,10 +1070,11 @@ srecord::arglex_tool::get_input()
                 uint32_t address = 0;
                 get_address(name, address);
                 ifp =
-                    input_filter_message_gcrypt::create_sha224
+                    input_filter_message_digest::create
                     (
                         ifp,
-                        address
+                        address,
+                        "SHA224"
                     );
             }
             break;
@@ -994,10 +1086,11 @@ srecord::arglex_tool::get_input()
                 uint32_t address = 0;
                 get_address(name, address);
                 ifp =
-                    input_filter_message_gcrypt::create_sha256
+                    input_filter_message_digest::create
                     (
                         ifp,
-                        address
+                        address,
+                        "SHA256"
                     );
             }
             break;
@@ -1009,10 +1102,11 @@ srecord::arglex_tool::get_input()
                 uint32_t address = 0;
                 get_address(name, address);
                 ifp =
-                    input_filter_message_gcrypt::create_sha384
+                    input_filter_message_digest::create
                     (
                         ifp,
-                        address
+                        address,
+                        "SHA384"
                     );
             }
             break;
@@ -1024,10 +1118,11 @@ srecord::arglex_tool::get_input()
                 uint32_t address = 0;
                 get_address(name, address);
                 ifp =
-                    input_filter_message_gcrypt::create_sha512
+                    input_filter_message_digest::create
                     (
                         ifp,
-                        address
+                        address,
+                        "SHA512"
                     );
             }
             break;
@@ -1167,8 +1262,16 @@ srecord::arglex_tool::get_input()
 
         default:
             //
-            // return the input stream determined
+            // Collapse each run of simple filters into a single pass,
+            // and return the input stream determined.
             //
+            ifp = input_filter_fused::optimize(ifp);
+            if (show_filter_plan)
+            {
+                std::cout.flush();
+                std::cerr << progname_get() << ": filter plan:\n"
+                    << input_filter_fused::plan(ifp);
+            }
             return ifp;
         }
 
@@ -0,0 +1,338 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cassert>
+
+#include <srecord/byte_sums.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SRECORD_BYTE_SUMS_X86 1
+#include <immintrin.h>
+#endif
+
+
+static void
+sums_scalar(const uint8_t *data, size_t len, uint32_t &sum,
+    uint32_t &weighted)
+{
+    uint32_t a = 0;
+    uint32_t b = 0;
+    for (size_t j = 0; j < len; ++j)
+    {
+        a += data[j];
+        b += a;
+    }
+    sum = a;
+    weighted = b;
+}
+
+
+#ifdef SRECORD_BYTE_SUMS_X86
+
+//
+// The vector versions work a block of 16 (or 32) bytes at a time.
+// Within a block, the byte at position j is weighted by (16 - j) using
+// a multiply-add against a constant vector.  Each whole block then
+// also counts 16 more times for every block after it; that part is
+// kept as a running sum of the block sums, and multiplied by the block
+// size at the end.  A tail shorter than a block is done by the scalar
+// code, and folded in the same way.
+//
+
+__attribute__((target("ssse3")))
+static void
+sums_ssse3(const uint8_t *data, size_t len, uint32_t &sum,
+    uint32_t &weighted)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i weights =
+        _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    __m128i vsum = zero;
+    __m128i vprev = zero;
+    __m128i vweighted = zero;
+    size_t nblocks = len / 16;
+    for (size_t j = 0; j < nblocks; ++j)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)(data + 16 * j));
+        vprev = _mm_add_epi32(vprev, vsum);
+        vsum = _mm_add_epi32(vsum, _mm_sad_epu8(x, zero));
+        __m128i m = _mm_maddubs_epi16(x, weights);
+        vweighted = _mm_add_epi32(vweighted, _mm_madd_epi16(m, ones));
+    }
+
+    //
+    // The sums are in 32-bit lanes 0 and 2 (from the 64-bit SAD
+    // results); the weighted sums are in all four lanes.
+    //
+    vsum = _mm_add_epi32(vsum, _mm_shuffle_epi32(vsum, 0xEE));
+    vprev = _mm_add_epi32(vprev, _mm_shuffle_epi32(vprev, 0xEE));
+    vweighted = _mm_add_epi32(vweighted, _mm_shuffle_epi32(vweighted, 0xEE));
+    vweighted = _mm_add_epi32(vweighted, _mm_shuffle_epi32(vweighted, 0x55));
+    uint32_t a = _mm_cvtsi128_si32(vsum);
+    uint32_t b = _mm_cvtsi128_si32(vweighted) + 16 * _mm_cvtsi128_si32(vprev);
+
+    size_t done = nblocks * 16;
+    uint32_t tail_sum;
+    uint32_t tail_weighted;
+    sums_scalar(data + done, len - done, tail_sum, tail_weighted);
+    sum = a + tail_sum;
+    weighted = b + (len - done) * a + tail_weighted;
+}
+
+
+__attribute__((target("avx2")))
+static void
+sums_avx2(const uint8_t *data, size_t len, uint32_t &sum,
+    uint32_t &weighted)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i weights =
+        _mm256_setr_epi8
+        (
+            32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+            16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+        );
+    __m256i vsum = zero;
+    __m256i vprev = zero;
+    __m256i vweighted = zero;
+    size_t nblocks = len / 32;
+    for (size_t j = 0; j < nblocks; ++j)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(data + 32 * j));
+        vprev = _mm256_add_epi32(vprev, vsum);
+        vsum = _mm256_add_epi32(vsum, _mm256_sad_epu8(x, zero));
+        __m256i m = _mm256_maddubs_epi16(x, weights);
+        vweighted = _mm256_add_epi32(vweighted, _mm256_madd_epi16(m, ones));
+    }
+
+    //
+    // Fold the two 128-bit halves together, then as for SSSE3.
+    //
+    __m128i s =
+        _mm_add_epi32
+        (
+            _mm256_castsi256_si128(vsum),
+            _mm256_extracti128_si256(vsum, 1)
+        );
+    __m128i p =
+        _mm_add_epi32
+        (
+            _mm256_castsi256_si128(vprev),
+            _mm256_extracti128_si256(vprev, 1)
+        );
+    __m128i w =
+        _mm_add_epi32
+        (
+            _mm256_castsi256_si128(vweighted),
+            _mm256_extracti128_si256(vweighted, 1)
+        );
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xEE));
+    p = _mm_add_epi32(p, _mm_shuffle_epi32(p, 0xEE));
+    w = _mm_add_epi32(w, _mm_shuffle_epi32(w, 0xEE));
+    w = _mm_add_epi32(w, _mm_shuffle_epi32(w, 0x55));
+    uint32_t a = _mm_cvtsi128_si32(s);
+    uint32_t b = _mm_cvtsi128_si32(w) + 32 * _mm_cvtsi128_si32(p);
+
+    //
+    // The tail may still be long enough for a 16-byte step.
+    //
+    size_t done = nblocks * 32;
+    uint32_t tail_sum;
+    uint32_t tail_weighted;
+    sums_ssse3(data + done, len - done, tail_sum, tail_weighted);
+    sum = a + tail_sum;
+    weighted = b + (len - done) * a + tail_weighted;
+}
+
+#endif
+
+
+typedef void (*sums_t)(const uint8_t *data, size_t len, uint32_t &sum,
+    uint32_t &weighted);
+
+
+static sums_t
+sums_select()
+{
+#ifdef SRECORD_BYTE_SUMS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return sums_avx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return sums_ssse3;
+#endif
+    return sums_scalar;
+}
+
+
+void
+srecord::byte_sums(const uint8_t *data, size_t len, uint32_t &sum,
+    uint32_t &weighted)
+{
+    assert(len <= byte_sums_max);
+    static const sums_t func = sums_select();
+    func(data, len, sum, weighted);
+}
+
+
+static void
+lanes_scalar(const uint8_t *data, size_t len, unsigned width,
+    uint32_t *sums)
+{
+    unsigned lane = 0;
+    for (size_t j = 0; j < len; ++j)
+    {
+        sums[lane] += data[j];
+        if (++lane == width)
+            lane = 0;
+    }
+}
+
+
+#ifdef SRECORD_BYTE_SUMS_X86
+
+//
+// The vector versions add each 16 (or 32) byte block into a running
+// total for each byte position, widened to 16 bits.  After 256 blocks
+// a position could hold 256 * 255, as much as 16 bits can take, so the
+// totals are flushed into 32 bits, then folded into the lanes
+// (position modulo width) at the end.  Because the width divides 16,
+// every block starts in lane zero.  A tail shorter than a block is
+// done by the narrower code.
+//
+
+__attribute__((target("sse2")))
+static void
+lanes_sse2(const uint8_t *data, size_t len, unsigned width,
+    uint32_t *sums)
+{
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t position[16] = { 0 };
+    size_t nblocks = len / 16;
+    size_t j = 0;
+    while (j < nblocks)
+    {
+        size_t end = j + 256;
+        if (end > nblocks)
+            end = nblocks;
+        __m128i lo = zero;
+        __m128i hi = zero;
+        for (; j < end; ++j)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)(data + 16 * j));
+            lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(x, zero));
+            hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(x, zero));
+        }
+        uint16_t total[16];
+        _mm_storeu_si128((__m128i *)total, lo);
+        _mm_storeu_si128((__m128i *)(total + 8), hi);
+        for (unsigned k = 0; k < 16; ++k)
+            position[k] += total[k];
+    }
+    for (unsigned k = 0; k < 16; ++k)
+        sums[k % width] += position[k];
+
+    size_t done = nblocks * 16;
+    lanes_scalar(data + done, len - done, width, sums);
+}
+
+
+__attribute__((target("avx2")))
+static void
+lanes_avx2(const uint8_t *data, size_t len, unsigned width,
+    uint32_t *sums)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    uint32_t position[16] = { 0 };
+    size_t nblocks = len / 32;
+    size_t j = 0;
+    while (j < nblocks)
+    {
+        size_t end = j + 256;
+        if (end > nblocks)
+            end = nblocks;
+        __m256i lo = zero;
+        __m256i hi = zero;
+        for (; j < end; ++j)
+        {
+            __m256i x =
+                _mm256_loadu_si256((const __m256i *)(data + 32 * j));
+            lo = _mm256_add_epi16(lo, _mm256_unpacklo_epi8(x, zero));
+            hi = _mm256_add_epi16(hi, _mm256_unpackhi_epi8(x, zero));
+        }
+
+        //
+        // The unpacks work within each 128-bit half, so lo holds
+        // positions 0 to 7 then 16 to 23, and hi holds 8 to 15 then
+        // 24 to 31.  Positions 16 apart are in the same lane.
+        //
+        uint16_t total[32];
+        _mm256_storeu_si256((__m256i *)total, lo);
+        _mm256_storeu_si256((__m256i *)(total + 16), hi);
+        for (unsigned k = 0; k < 8; ++k)
+        {
+            position[k] += total[k] + total[k + 8];
+            position[k + 8] += total[k + 16] + total[k + 24];
+        }
+    }
+    for (unsigned k = 0; k < 16; ++k)
+        sums[k % width] += position[k];
+
+    size_t done = nblocks * 32;
+    lanes_sse2(data + done, len - done, width, sums);
+}
+
+#endif
+
+
+typedef void (*lanes_t)(const uint8_t *data, size_t len, unsigned width,
+    uint32_t *sums);
+
+
+static lanes_t
+lanes_select()
+{
+#ifdef SRECORD_BYTE_SUMS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return lanes_avx2;
+    if (__builtin_cpu_supports("sse2"))
+        return lanes_sse2;
+#endif
+    return lanes_scalar;
+}
+
+
+void
+srecord::byte_lane_sums(const uint8_t *data, size_t len, unsigned width,
+    uint32_t *sums)
+{
+    assert(width >= 1);
+    for (unsigned k = 0; k < width; ++k)
+        sums[k] = 0;
+    if (width > 16 || 16 % width != 0)
+    {
+        lanes_scalar(data, len, width, sums);
+        return;
+    }
+    static const lanes_t func = lanes_select();
+    func(data, len, width, sums);
+}
@@ -0,0 +1,86 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_BYTE_SUMS_H
+#define SRECORD_BYTE_SUMS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace srecord
+{
+
+/**
+  * The byte_sums_max constant is the longest buffer the #byte_sums
+  * function will accept, chosen so that neither sum can overflow 32
+  * bits.
+  */
+static const size_t byte_sums_max = 4096;
+
+/**
+  * The byte_sums function is used to calculate, in one pass, the two
+  * sums the Fletcher and Adler checksums are made of.  Feeding the
+  * bytes one at a time into a running pair (a, b), with a += data[i]
+  * and b += a, gives the same result as a += sum and
+  * b += len * a + weighted, with the sums as below.  This lets the
+  * checksum classes defer their modulo arithmetic to once per block.
+  *
+  * It picks the widest vector instructions the CPU supports at run
+  * time (AVX2, then SSSE3, on x86), and falls back to portable code
+  * elsewhere.  The results are always the same.
+  *
+  * @param data
+  *     The base address of the bytes to be summed.
+  * @param len
+  *     The number of bytes to be summed, at most #byte_sums_max.
+  * @param sum
+  *     Set to the sum of the bytes.
+  * @param weighted
+  *     Set to the sum of each byte times (len - i), where i is its
+  *     index; the first byte is counted len times, the last once.
+  */
+void byte_sums(const uint8_t *data, size_t len, uint32_t &sum,
+    uint32_t &weighted);
+
+/**
+  * The byte_lane_sums function is used to calculate, in one pass, the
+  * sums of the bytes in each lane of a buffer cut into words of the
+  * given width: lane k holds every byte whose index, modulo width, is
+  * k.  A positional checksum of the words can then shift each lane
+  * sum into place once, rather than shifting every byte.
+  *
+  * As for #byte_sums, vector instructions are used when the CPU has
+  * them and the width divides 16; the results are always the same.
+  * The sums wrap modulo 2**32, and there is no limit on the length.
+  *
+  * @param data
+  *     The base address of the bytes to be summed.
+  * @param len
+  *     The number of bytes to be summed.
+  * @param width
+  *     The number of lanes, at least one.
+  * @param sums
+  *     Set to the sum of each lane, width values.
+  */
+void byte_lane_sums(const uint8_t *data, size_t len, unsigned width,
+    uint32_t *sums);
+
+};
+
+#endif // SRECORD_BYTE_SUMS_H
@@ -0,0 +1,294 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/byte_transform.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SRECORD_BYTE_TRANSFORM_X86 1
+#include <immintrin.h>
+#endif
+
+
+enum op_t
+{
+    op_and,
+    op_or,
+    op_xor,
+    op_bitrev,
+    op_nibble_swap
+};
+
+
+/**
+  * The nibble_rev table is used to reverse the bits of a 4-bit value.
+  * Reversing a byte is reversing each nibble, and swapping them.  The
+  * vector implementations use the same table as a shuffle operand.
+  */
+static const uint8_t nibble_rev[16] =
+{
+    0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+    0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF,
+};
+
+
+static void
+transform_scalar(uint8_t *data, size_t len, op_t op, uint8_t value)
+{
+    switch (op)
+    {
+    case op_and:
+        for (size_t j = 0; j < len; ++j)
+            data[j] &= value;
+        break;
+
+    case op_or:
+        for (size_t j = 0; j < len; ++j)
+            data[j] |= value;
+        break;
+
+    case op_xor:
+        for (size_t j = 0; j < len; ++j)
+            data[j] ^= value;
+        break;
+
+    case op_bitrev:
+        for (size_t j = 0; j < len; ++j)
+        {
+            uint8_t c = data[j];
+            data[j] = (nibble_rev[c & 0x0F] << 4) | nibble_rev[c >> 4];
+        }
+        break;
+
+    case op_nibble_swap:
+        for (size_t j = 0; j < len; ++j)
+        {
+            uint8_t c = data[j];
+            data[j] = (c << 4) | (c >> 4);
+        }
+        break;
+    }
+}
+
+
+#ifdef SRECORD_BYTE_TRANSFORM_X86
+
+__attribute__((target("ssse3")))
+static void
+transform_ssse3(uint8_t *data, size_t len, op_t op, uint8_t value)
+{
+    const __m128i low = _mm_set1_epi8(0x0F);
+    const __m128i rev = _mm_loadu_si128((const __m128i *)nibble_rev);
+    const __m128i v = _mm_set1_epi8((char)value);
+    size_t j = 0;
+    switch (op)
+    {
+    case op_and:
+        for (; j + 16 <= len; j += 16)
+        {
+            auto *p = (__m128i *)(data + j);
+            _mm_storeu_si128(p, _mm_and_si128(_mm_loadu_si128(p), v));
+        }
+        break;
+
+    case op_or:
+        for (; j + 16 <= len; j += 16)
+        {
+            auto *p = (__m128i *)(data + j);
+            _mm_storeu_si128(p, _mm_or_si128(_mm_loadu_si128(p), v));
+        }
+        break;
+
+    case op_xor:
+        for (; j + 16 <= len; j += 16)
+        {
+            auto *p = (__m128i *)(data + j);
+            _mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), v));
+        }
+        break;
+
+    case op_bitrev:
+        for (; j + 16 <= len; j += 16)
+        {
+            auto *p = (__m128i *)(data + j);
+            __m128i x = _mm_loadu_si128(p);
+            __m128i lo = _mm_and_si128(x, low);
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), low);
+            lo = _mm_slli_epi16(_mm_shuffle_epi8(rev, lo), 4);
+            hi = _mm_shuffle_epi8(rev, hi);
+            _mm_storeu_si128(p, _mm_or_si128(lo, hi));
+        }
+        break;
+
+    case op_nibble_swap:
+        for (; j + 16 <= len; j += 16)
+        {
+            auto *p = (__m128i *)(data + j);
+            __m128i x = _mm_loadu_si128(p);
+            __m128i lo = _mm_slli_epi16(_mm_and_si128(x, low), 4);
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), low);
+            _mm_storeu_si128(p, _mm_or_si128(lo, hi));
+        }
+        break;
+    }
+    transform_scalar(data + j, len - j, op, value);
+}
+
+
+__attribute__((target("avx2")))
+static void
+transform_avx2(uint8_t *data, size_t len, op_t op, uint8_t value)
+{
+    //
+    // The AVX2 shuffle works within each 128-bit lane, so the table is
+    // repeated in both lanes.
+    //
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    const __m256i rev =
+        _mm256_broadcastsi128_si256
+        (
+            _mm_loadu_si128((const __m128i *)nibble_rev)
+        );
+    const __m256i v = _mm256_set1_epi8((char)value);
+    size_t j = 0;
+    switch (op)
+    {
+    case op_and:
+        for (; j + 32 <= len; j += 32)
+        {
+            auto *p = (__m256i *)(data + j);
+            _mm256_storeu_si256(p, _mm256_and_si256(_mm256_loadu_si256(p), v));
+        }
+        break;
+
+    case op_or:
+        for (; j + 32 <= len; j += 32)
+        {
+            auto *p = (__m256i *)(data + j);
+            _mm256_storeu_si256(p, _mm256_or_si256(_mm256_loadu_si256(p), v));
+        }
+        break;
+
+    case op_xor:
+        for (; j + 32 <= len; j += 32)
+        {
+            auto *p = (__m256i *)(data + j);
+            _mm256_storeu_si256(p, _mm256_xor_si256(_mm256_loadu_si256(p), v));
+        }
+        break;
+
+    case op_bitrev:
+        for (; j + 32 <= len; j += 32)
+        {
+            auto *p = (__m256i *)(data + j);
+            __m256i x = _mm256_loadu_si256(p);
+            __m256i lo = _mm256_and_si256(x, low);
+            __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), low);
+            lo = _mm256_slli_epi16(_mm256_shuffle_epi8(rev, lo), 4);
+            hi = _mm256_shuffle_epi8(rev, hi);
+            _mm256_storeu_si256(p, _mm256_or_si256(lo, hi));
+        }
+        break;
+
+    case op_nibble_swap:
+        for (; j + 32 <= len; j += 32)
+        {
+            auto *p = (__m256i *)(data + j);
+            __m256i x = _mm256_loadu_si256(p);
+            __m256i lo = _mm256_slli_epi16(_mm256_and_si256(x, low), 4);
+            __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), low);
+            _mm256_storeu_si256(p, _mm256_or_si256(lo, hi));
+        }
+        break;
+    }
+
+    //
+    // The tail may still be long enough for a 16-byte step.
+    //
+    transform_ssse3(data + j, len - j, op, value);
+}
+
+#endif
+
+
+typedef void (*transform_t)(uint8_t *data, size_t len, op_t op,
+    uint8_t value);
+
+
+static transform_t
+transform_select()
+{
+#ifdef SRECORD_BYTE_TRANSFORM_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return transform_avx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return transform_ssse3;
+#endif
+    return transform_scalar;
+}
+
+
+static void
+transform(uint8_t *data, size_t len, op_t op, uint8_t value)
+{
+    static const transform_t func = transform_select();
+    func(data, len, op, value);
+}
+
+
+void
+srecord::byte_transform_and(uint8_t *data, size_t len, uint8_t value)
+{
+    transform(data, len, op_and, value);
+}
+
+
+void
+srecord::byte_transform_or(uint8_t *data, size_t len, uint8_t value)
+{
+    transform(data, len, op_or, value);
+}
+
+
+void
+srecord::byte_transform_xor(uint8_t *data, size_t len, uint8_t value)
+{
+    transform(data, len, op_xor, value);
+}
+
+
+void
+srecord::byte_transform_not(uint8_t *data, size_t len)
+{
+    transform(data, len, op_xor, 0xFF);
+}
+
+
+void
+srecord::byte_transform_bitrev(uint8_t *data, size_t len)
+{
+    transform(data, len, op_bitrev, 0);
+}
+
+
+void
+srecord::byte_transform_nibble_swap(uint8_t *data, size_t len)
+{
+    transform(data, len, op_nibble_swap, 0);
+}
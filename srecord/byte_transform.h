@@ -0,0 +1,108 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_BYTE_TRANSFORM_H
+#define SRECORD_BYTE_TRANSFORM_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace srecord
+{
+
+/**
+  * The byte_transform_and function is used to bit-wise AND every byte
+  * of a buffer with a value, in place.
+  *
+  * These byte_transform functions pick the widest vector instructions
+  * the CPU supports at run time (AVX2, then SSSE3, on x86), and fall
+  * back to portable code elsewhere.  The results are always the same.
+  *
+  * @param data
+  *     The base address of the bytes to be transformed.
+  * @param len
+  *     The number of bytes to be transformed.
+  * @param value
+  *     The value to AND with each byte.
+  */
+void byte_transform_and(uint8_t *data, size_t len, uint8_t value);
+
+/**
+  * The byte_transform_or function is used to bit-wise OR every byte
+  * of a buffer with a value, in place.
+  *
+  * @param data
+  *     The base address of the bytes to be transformed.
+  * @param len
+  *     The number of bytes to be transformed.
+  * @param value
+  *     The value to OR with each byte.
+  */
+void byte_transform_or(uint8_t *data, size_t len, uint8_t value);
+
+/**
+  * The byte_transform_xor function is used to bit-wise exclusive OR
+  * every byte of a buffer with a value, in place.
+  *
+  * @param data
+  *     The base address of the bytes to be transformed.
+  * @param len
+  *     The number of bytes to be transformed.
+  * @param value
+  *     The value to XOR with each byte.
+  */
+void byte_transform_xor(uint8_t *data, size_t len, uint8_t value);
+
+/**
+  * The byte_transform_not function is used to bit-wise invert every
+  * byte of a buffer, in place.
+  *
+  * @param data
+  *     The base address of the bytes to be transformed.
+  * @param len
+  *     The number of bytes to be transformed.
+  */
+void byte_transform_not(uint8_t *data, size_t len);
+
+/**
+  * The byte_transform_bitrev function is used to reverse the order of
+  * the bits within every byte of a buffer, in place.  It gives the
+  * same results as calling #bitrev8 on each byte.
+  *
+  * @param data
+  *     The base address of the bytes to be transformed.
+  * @param len
+  *     The number of bytes to be transformed.
+  */
+void byte_transform_bitrev(uint8_t *data, size_t len);
+
+/**
+  * The byte_transform_nibble_swap function is used to swap the high
+  * and low nibbles of every byte of a buffer, in place.
+  *
+  * @param data
+  *     The base address of the bytes to be transformed.
+  * @param len
+  *     The number of bytes to be transformed.
+  */
+void byte_transform_nibble_swap(uint8_t *data, size_t len);
+
+};
+
+#endif // SRECORD_BYTE_TRANSFORM_H
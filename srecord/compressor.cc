@@ -0,0 +1,47 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/compressor.h>
+#include <srecord/output.h>
+
+
+srecord::compressor::~compressor() = default;
+
+
+srecord::compressor::compressor(FILE *a_fp, const output &a_owner) :
+    owner(a_owner),
+    fp(a_fp)
+{
+}
+
+
+size_t
+srecord::compressor::preferred_block_size()
+    const
+{
+    return (1uL << 20);
+}
+
+
+void
+srecord::compressor::put(const void *data, size_t nbytes)
+{
+    if (nbytes && fwrite(data, 1, nbytes, fp) != nbytes)
+        owner.fatal_error_errno("write");
+}
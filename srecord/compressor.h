@@ -0,0 +1,129 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_COMPRESSOR_H
+#define SRECORD_COMPRESSOR_H
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+
+namespace srecord
+{
+
+class output; // forward
+
+/**
+  * The srecord::compressor class is used to represent an abstract
+  * stream compressor, sitting between an output file and the stdio
+  * file it is written to.  The output file accumulates its text (or
+  * binary) in a large buffer, and hands it to the compressor a block
+  * at a time.
+  */
+class compressor
+{
+public:
+    /**
+      * The pointer type is to be used for all pointers to compressors.
+      */
+    typedef std::shared_ptr<compressor> pointer;
+
+    /**
+      * The destructor.
+      */
+    virtual ~compressor();
+
+    /**
+      * The write method is used to compress a block of data, and write
+      * whatever compressed output is ready to the file.
+      *
+      * @param data
+      *     The base address of the bytes to be compressed.
+      * @param nbytes
+      *     The number of bytes to be compressed.
+      */
+    virtual void write(const void *data, size_t nbytes) = 0;
+
+    /**
+      * The finish method is used to flush all pending compressed
+      * output, and write the stream trailer.  It must be called exactly
+      * once, after the last #write.
+      */
+    virtual void finish() = 0;
+
+    /**
+      * The preferred_block_size method is used to obtain the size of
+      * the blocks the compressor would like to be fed.  Larger blocks
+      * amortise the per-call overhead, and give multithreaded
+      * compressors whole jobs to work on.
+      */
+    virtual size_t preferred_block_size() const;
+
+protected:
+    /**
+      * The constructor.  May only be called by derived classes.
+      *
+      * @param fp
+      *     The stdio file to write the compressed output to.
+      * @param owner
+      *     The output which owns this compressor, used to report
+      *     errors.
+      */
+    compressor(FILE *fp, const output &owner);
+
+    /**
+      * The put method is used by derived classes to write compressed
+      * bytes to the file.  Write errors are fatal.
+      */
+    void put(const void *data, size_t nbytes);
+
+    /**
+      * The owner instance variable is used to remember the output which
+      * owns this compressor, so that errors may be reported in terms of
+      * the output file name.
+      */
+    const output &owner;
+
+private:
+    /**
+      * The fp instance variable is used to remember the stdio file the
+      * compressed output is written to.
+      */
+    FILE *fp;
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    compressor() = delete;
+
+    /**
+      * The copy constructor.  Do not use.
+      */
+    compressor(const compressor &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    compressor &operator=(const compressor &) = delete;
+};
+
+};
+
+#endif // SRECORD_COMPRESSOR_H
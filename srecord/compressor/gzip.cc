@@ -0,0 +1,127 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/compressor/gzip.h>
+#include <srecord/output.h>
+#include <srecord/quit.h>
+
+
+srecord::compressor_gzip::~compressor_gzip()
+{
+#ifdef HAVE_LIBZ
+    deflateEnd(&stream);
+#endif
+}
+
+
+srecord::compressor_gzip::compressor_gzip(FILE *a_fp, const output &a_owner) :
+    compressor(a_fp, a_owner)
+{
+#ifdef HAVE_LIBZ
+    stream = z_stream();
+    //
+    // Adding 16 to the window bits asks zlib for a gzip header and
+    // trailer, rather than a bare zlib stream.
+    //
+    int err =
+        deflateInit2
+        (
+            &stream,
+            Z_DEFAULT_COMPRESSION,
+            Z_DEFLATED,
+            15 + 16,
+            8,
+            Z_DEFAULT_STRATEGY
+        );
+    if (err != Z_OK)
+        owner.fatal_error("gzip: %s", zError(err));
+#endif
+}
+
+
+srecord::compressor::pointer
+srecord::compressor_gzip::create(FILE *a_fp, const output &a_owner)
+{
+#ifdef HAVE_LIBZ
+    return pointer(new compressor_gzip(a_fp, a_owner));
+#else
+    (void)a_fp;
+    (void)a_owner;
+    quit_default.fatal_error("zlib not available");
+    return pointer();
+#endif
+}
+
+
+#ifdef HAVE_LIBZ
+
+void
+srecord::compressor_gzip::deflate_all(int flush)
+{
+    unsigned char buffer[1 << 16];
+    for (;;)
+    {
+        stream.next_out = buffer;
+        stream.avail_out = sizeof(buffer);
+        int err = deflate(&stream, flush);
+        if (err != Z_OK && err != Z_STREAM_END && err != Z_BUF_ERROR)
+            owner.fatal_error("gzip: %s", zError(err));
+        put(buffer, sizeof(buffer) - stream.avail_out);
+        if (flush == Z_FINISH ? err == Z_STREAM_END : stream.avail_out != 0)
+            break;
+    }
+}
+
+#endif
+
+
+void
+srecord::compressor_gzip::write(const void *data, size_t nbytes)
+{
+#ifdef HAVE_LIBZ
+    //
+    // The zlib avail_in is only an unsigned int, so very large blocks
+    // are fed in pieces.
+    //
+    const auto *cp = (const unsigned char *)data;
+    while (nbytes > 0)
+    {
+        uInt len = nbytes > (1u << 30) ? (1u << 30) : (uInt)nbytes;
+        stream.next_in = (Bytef *)cp;
+        stream.avail_in = len;
+        deflate_all(Z_NO_FLUSH);
+        cp += len;
+        nbytes -= len;
+    }
+#else
+    (void)data;
+    (void)nbytes;
+#endif
+}
+
+
+void
+srecord::compressor_gzip::finish()
+{
+#ifdef HAVE_LIBZ
+    stream.next_in = nullptr;
+    stream.avail_in = 0;
+    deflate_all(Z_FINISH);
+#endif
+}
@@ -0,0 +1,112 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_COMPRESSOR_GZIP_H
+#define SRECORD_COMPRESSOR_GZIP_H
+
+#include <config.h>
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+#include <srecord/compressor.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::compressor_gzip class is used to represent writing a
+  * gzip (RFC 1952) stream, using the zlib library.  The zlib library
+  * has no multithreaded compressor, so this one runs on the calling
+  * thread.
+  */
+class compressor_gzip:
+    public compressor
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~compressor_gzip() override;
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.  If zlib was not available
+      * when SRecord was built, this is a fatal error.
+      *
+      * @param fp
+      *     The stdio file to write the compressed output to.
+      * @param owner
+      *     The output which owns this compressor, used to report
+      *     errors.
+      */
+    static pointer create(FILE *fp, const output &owner);
+
+protected:
+    // See base class for documentation.
+    void write(const void *data, size_t nbytes) override;
+
+    // See base class for documentation.
+    void finish() override;
+
+private:
+    /**
+      * The constructor.  It is private on purpose, use the #create
+      * class method instead.
+      */
+    compressor_gzip(FILE *fp, const output &owner);
+
+#ifdef HAVE_LIBZ
+    /**
+      * The stream instance variable is used to remember the state of
+      * the zlib deflate engine.
+      */
+    z_stream stream;
+
+    /**
+      * The deflate_all method is used to run the deflate engine until
+      * all of the pending input has been consumed, writing compressed
+      * output to the file as it is produced.
+      *
+      * @param flush
+      *     The zlib flush mode, Z_NO_FLUSH or Z_FINISH.
+      */
+    void deflate_all(int flush);
+#endif
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    compressor_gzip() = delete;
+
+    /**
+      * The copy constructor.  Do not use.
+      */
+    compressor_gzip(const compressor_gzip &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    compressor_gzip &operator=(const compressor_gzip &) = delete;
+};
+
+};
+
+#endif // SRECORD_COMPRESSOR_GZIP_H
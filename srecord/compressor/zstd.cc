@@ -0,0 +1,132 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <thread>
+#include <vector>
+
+#include <srecord/compressor/zstd.h>
+#include <srecord/output.h>
+#include <srecord/quit.h>
+
+
+srecord::compressor_zstd::~compressor_zstd()
+{
+#ifdef HAVE_LIBZSTD
+    ZSTD_freeCCtx(cctx);
+#endif
+}
+
+
+srecord::compressor_zstd::compressor_zstd(FILE *a_fp, const output &a_owner) :
+    compressor(a_fp, a_owner),
+    cctx(nullptr),
+    workers(0)
+{
+#ifdef HAVE_LIBZSTD
+    cctx = ZSTD_createCCtx();
+    if (!cctx)
+        owner.fatal_error("zstd: unable to create compression context");
+    ZSTD_CCtx_setParameter
+    (
+        cctx,
+        ZSTD_c_compressionLevel,
+        ZSTD_CLEVEL_DEFAULT
+    );
+    ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, 1);
+
+    //
+    // Asking for workers fails harmlessly if the library was built
+    // without thread support; compression then happens on this thread.
+    //
+    unsigned ncpu = std::thread::hardware_concurrency();
+    if (ncpu > 1)
+    {
+        size_t err = ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, ncpu);
+        if (!ZSTD_isError(err))
+            workers = ncpu;
+    }
+#endif
+}
+
+
+srecord::compressor::pointer
+srecord::compressor_zstd::create(FILE *a_fp, const output &a_owner)
+{
+#ifdef HAVE_LIBZSTD
+    return pointer(new compressor_zstd(a_fp, a_owner));
+#else
+    (void)a_fp;
+    (void)a_owner;
+    quit_default.fatal_error("libzstd not available");
+    return pointer();
+#endif
+}
+
+
+size_t
+srecord::compressor_zstd::preferred_block_size()
+    const
+{
+    //
+    // The library slices its input into per-worker jobs of a few
+    // megabytes, so feed it at least one job's worth at a time.
+    //
+    if (workers)
+        return (size_t(1) << 22);
+    return compressor::preferred_block_size();
+}
+
+
+void
+srecord::compressor_zstd::compress(const void *data, size_t nbytes, bool last)
+{
+#ifdef HAVE_LIBZSTD
+    std::vector<unsigned char> buffer(ZSTD_CStreamOutSize());
+    ZSTD_inBuffer in = { data, nbytes, 0 };
+    ZSTD_EndDirective mode = last ? ZSTD_e_end : ZSTD_e_continue;
+    for (;;)
+    {
+        ZSTD_outBuffer out = { buffer.data(), buffer.size(), 0 };
+        size_t remaining = ZSTD_compressStream2(cctx, &out, &in, mode);
+        if (ZSTD_isError(remaining))
+            owner.fatal_error("zstd: %s", ZSTD_getErrorName(remaining));
+        put(buffer.data(), out.pos);
+        if (last ? remaining == 0 : in.pos == in.size)
+            break;
+    }
+#else
+    (void)data;
+    (void)nbytes;
+    (void)last;
+#endif
+}
+
+
+void
+srecord::compressor_zstd::write(const void *data, size_t nbytes)
+{
+    compress(data, nbytes, false);
+}
+
+
+void
+srecord::compressor_zstd::finish()
+{
+    compress(nullptr, 0, true);
+}
@@ -0,0 +1,126 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_COMPRESSOR_ZSTD_H
+#define SRECORD_COMPRESSOR_ZSTD_H
+
+#include <config.h>
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+#else
+typedef struct ZSTD_CCtx_s ZSTD_CCtx;
+#endif
+
+#include <srecord/compressor.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::compressor_zstd class is used to represent writing a
+  * Zstandard (RFC 8878) stream, using the zstd library.  When the
+  * library was built with thread support, compression is spread across
+  * one worker per processor.
+  */
+class compressor_zstd:
+    public compressor
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~compressor_zstd() override;
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.  If libzstd was not available
+      * when SRecord was built, this is a fatal error.
+      *
+      * @param fp
+      *     The stdio file to write the compressed output to.
+      * @param owner
+      *     The output which owns this compressor, used to report
+      *     errors.
+      */
+    static pointer create(FILE *fp, const output &owner);
+
+protected:
+    // See base class for documentation.
+    void write(const void *data, size_t nbytes) override;
+
+    // See base class for documentation.
+    void finish() override;
+
+    // See base class for documentation.
+    size_t preferred_block_size() const override;
+
+private:
+    /**
+      * The constructor.  It is private on purpose, use the #create
+      * class method instead.
+      */
+    compressor_zstd(FILE *fp, const output &owner);
+
+    /**
+      * The cctx instance variable is used to remember the state of
+      * the zstd compression engine.
+      */
+    ZSTD_CCtx *cctx;
+
+    /**
+      * The workers instance variable is used to remember how many
+      * compression threads were obtained (zero when compressing on the
+      * calling thread).
+      */
+    unsigned workers;
+
+    /**
+      * The compress method is used to run the zstd engine over a block
+      * of input, writing compressed output to the file as it is
+      * produced.
+      *
+      * @param data
+      *     The base address of the bytes to be compressed.
+      * @param nbytes
+      *     The number of bytes to be compressed.
+      * @param last
+      *     true if this is the end of the stream, false if not
+      */
+    void compress(const void *data, size_t nbytes, bool last);
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    compressor_zstd() = delete;
+
+    /**
+      * The copy constructor.  Do not use.
+      */
+    compressor_zstd(const compressor_zstd &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    compressor_zstd &operator=(const compressor_zstd &) = delete;
+};
+
+};
+
+#endif // SRECORD_COMPRESSOR_ZSTD_H
@@ -29,10 +29,13 @@
 //
 
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <string>
 
 #include <srecord/bitrev.h>
 #include <srecord/crc16.h>
+#include <srecord/crc_combine.h>
 #include <srecord/quit.h>
 #include <srecord/sizeof.h>
 
@@ -66,35 +69,88 @@ static uint16_t const broken_seed = 0x84CF;
 static uint16_t const xmodem_seed = 0;
 
 
-void
-srecord::crc16::calculate_table()
+//
+// The table rows depend only on the polynomial and the bit direction,
+// so each combination is built once, the first time it is asked for,
+// and shared by every crc16 using it.  Copies of a crc16, such as the
+// slices of memory::walk_parallel, copy only the pointer to it.  The
+// lock is needed because those slices may be made on other threads.
+//
+
+struct crc16_table
 {
-    if (polynomial == 0)
-        polynomial = polynomial_ccitt;
-    if (bitdir == bit_direction_most_to_least)
+    crc16_table(uint16_t polynomial, bool reflect);
+
+    uint16_t row[8][256];
+};
+
+
+crc16_table::crc16_table(uint16_t polynomial, bool reflect)
+{
+    if (!reflect)
     {
         for (unsigned b = 0; b < 256; ++b)
         {
             uint16_t v = b << 8;
             for (unsigned j = 0; j < 8; ++j)
                 v = (v & 0x8000) ? ((v << 1) ^ polynomial) : (v << 1);
-            table[b] = v;
+            row[0][b] = v;
+        }
+        for (unsigned k = 1; k < 8; ++k)
+        {
+            for (unsigned b = 0; b < 256; ++b)
+            {
+                uint16_t v = row[k - 1][b];
+                row[k][b] = (v << 8) ^ row[0][v >> 8];
+            }
         }
     }
     else
     {
-        polynomial = bitrev16(polynomial);
         for (unsigned b = 0; b < 256; ++b)
         {
             uint16_t v = b;
             for (unsigned j = 0; j < 8; ++j)
                 v = (v & 1) ? ((v >> 1) ^ polynomial) : (v >> 1);
-            table[b] = v;
+            row[0][b] = v;
+        }
+        for (unsigned k = 1; k < 8; ++k)
+        {
+            for (unsigned b = 0; b < 256; ++b)
+            {
+                uint16_t v = row[k - 1][b];
+                row[k][b] = (v >> 8) ^ row[0][v & 0xFF];
+            }
         }
     }
 }
 
 
+static const uint16_t (*
+get_table(uint16_t polynomial, bool reflect))[256]
+{
+    static std::mutex lock;
+    static std::map<uint32_t, crc16_table> tables;
+
+    std::lock_guard<std::mutex> guard(lock);
+    uint32_t key = polynomial | (reflect ? 0x10000 : 0);
+    auto it = tables.try_emplace(key, polynomial, reflect).first;
+    return it->second.row;
+}
+
+
+void
+srecord::crc16::calculate_table()
+{
+    if (polynomial == 0)
+        polynomial = polynomial_ccitt;
+    bool reflect = (bitdir == bit_direction_least_to_most);
+    if (reflect)
+        polynomial = bitrev16(polynomial);
+    table = get_table(polynomial, reflect);
+}
+
+
 static int
 state_from_seed_mode(srecord::crc16::seed_mode_t seed_mode)
 {
@@ -138,33 +194,6 @@ srecord::crc16::crc16(
 }
 
 
-srecord::crc16::crc16(const crc16 &rhs) :
-    state(rhs.state),
-    augment(rhs.augment),
-    polynomial(rhs.polynomial),
-    bitdir(rhs.bitdir)
-{
-    for (size_t j = 0; j < 256; ++j)
-        table[j] = rhs.table[j];
-}
-
-
-srecord::crc16 &
-srecord::crc16::operator=(const crc16 &rhs)
-{
-    if (this != &rhs)
-    {
-        state = rhs.state;
-        augment = rhs.augment;
-        polynomial = rhs.polynomial;
-        bitdir = rhs.bitdir;
-        for (size_t j = 0; j < 256; ++j)
-            table[j] = rhs.table[j];
-    }
-    return *this;
-}
-
-
 #if (IMPL == IMPL_CH9)
 
 //
@@ -229,11 +258,11 @@ srecord::crc16::updcrc(uint8_t c, uint16_t state)
 {
     if (bitdir == bit_direction_least_to_most)
     {
-        return (((state >> 8) & 0xFF) | (c << 8)) ^ table[state & 0xFF];
+        return (((state >> 8) & 0xFF) | (c << 8)) ^ table[0][state & 0xFF];
     }
     else
     {
-        return ((state << 8) | c) ^ table[state >> 8];
+        return ((state << 8) | c) ^ table[0][state >> 8];
     }
 }
 
@@ -256,9 +285,9 @@ srecord::crc16::updcrc(uint8_t c, uint16_t state)
     const
 {
     if (bitdir == bit_direction_least_to_most)
-        return (state >> 8) ^ table[(state ^ c) & 0xFF];
+        return (state >> 8) ^ table[0][(state ^ c) & 0xFF];
     else
-        return (state << 8) ^ table[((state >> 8) ^ c) & 0xFF];
+        return (state << 8) ^ table[0][((state >> 8) ^ c) & 0xFF];
 }
 
 #endif // IMPL_CH11
@@ -274,7 +303,76 @@ srecord::crc16::next(uint8_t ch)
 void
 srecord::crc16::nextbuf(const void *data, size_t nbytes)
 {
-    auto *dp = (uint8_t *)data;
+    const auto *dp = (const uint8_t *)data;
+#if (IMPL == IMPL_CH10)
+    //
+    // The state is the remainder of everything shifted in so far,
+    // modulo the polynomial.  Shifting in another eight bytes
+    // multiplies the state by x^64 and adds the bytes; the state's
+    // two bytes and the first six data bytes are each multiplied by
+    // the right power of x by a lookup in the matching table row,
+    // and the last two data bytes are still below x^16, so they go
+    // in unchanged.  Then the same again for four bytes.
+    //
+    if (bitdir == bit_direction_least_to_most)
+    {
+        while (nbytes >= 8)
+        {
+            state =
+                table[7][state & 0xFF] ^ table[6][state >> 8]
+            ^
+                table[5][dp[0]] ^ table[4][dp[1]]
+            ^
+                table[3][dp[2]] ^ table[2][dp[3]]
+            ^
+                table[1][dp[4]] ^ table[0][dp[5]]
+            ^
+                (dp[6] | (dp[7] << 8));
+            dp += 8;
+            nbytes -= 8;
+        }
+        if (nbytes >= 4)
+        {
+            state =
+                table[3][state & 0xFF] ^ table[2][state >> 8]
+            ^
+                table[1][dp[0]] ^ table[0][dp[1]]
+            ^
+                (dp[2] | (dp[3] << 8));
+            dp += 4;
+            nbytes -= 4;
+        }
+    }
+    else
+    {
+        while (nbytes >= 8)
+        {
+            state =
+                table[7][state >> 8] ^ table[6][state & 0xFF]
+            ^
+                table[5][dp[0]] ^ table[4][dp[1]]
+            ^
+                table[3][dp[2]] ^ table[2][dp[3]]
+            ^
+                table[1][dp[4]] ^ table[0][dp[5]]
+            ^
+                ((dp[6] << 8) | dp[7]);
+            dp += 8;
+            nbytes -= 8;
+        }
+        if (nbytes >= 4)
+        {
+            state =
+                table[3][state >> 8] ^ table[2][state & 0xFF]
+            ^
+                table[1][dp[0]] ^ table[0][dp[1]]
+            ^
+                ((dp[2] << 8) | dp[3]);
+            dp += 4;
+            nbytes -= 4;
+        }
+    }
+#endif
     while (nbytes > 0)
     {
         state = updcrc(*dp++, state);
@@ -283,11 +381,55 @@ srecord::crc16::nextbuf(const void *data, size_t nbytes)
 }
 
 
+void
+srecord::crc16::clear()
+{
+    state = 0;
+}
+
+
+void
+srecord::crc16::combine(const crc16 &later, size_t nbytes)
+{
+    if (bitdir == bit_direction_least_to_most)
+    {
+        // register and polynomial are both kept bit reversed
+        state =
+            bitrev16
+            (
+                crc_combine
+                (
+                    bitrev16(state),
+                    bitrev16(later.state),
+                    nbytes,
+                    bitrev16(polynomial),
+                    16
+                )
+            );
+    }
+    else
+    {
+        state = crc_combine(state, later.state, nbytes, polynomial, 16);
+    }
+}
+
+
 uint16_t
 srecord::crc16::get()
     const
 {
-#if (IMPL < IMPL_CH11)
+#if (IMPL == IMPL_CH10)
+    //
+    // The 16 zero bits of augmentation multiply the state by x^16,
+    // which is two table lookups.
+    //
+    if (augment)
+    {
+        if (bitdir == bit_direction_least_to_most)
+            return table[1][state & 0xFF] ^ table[0][state >> 8];
+        return table[1][state >> 8] ^ table[0][state & 0xFF];
+    }
+#elif (IMPL < IMPL_CH11)
     // The whole idea is that Ch.11 technique is "pre-augmented"
     if (augment)
     {
@@ -328,7 +470,7 @@ srecord::crc16::print_table()
     {
         if ((j & 7) == 0)
             printf("    /* %02X */", int(j));
-        printf(" 0x%04X,", table[j]);
+        printf(" 0x%04X,", table[0][j]);
         if ((j & 7) == 7)
             printf("\n");
     }
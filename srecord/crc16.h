@@ -119,12 +119,12 @@ class crc16
     /**
       * The copy constructor.
       */
-    crc16(const crc16 &);
+    crc16(const crc16 &) = default;
 
     /**
       * The assignment operator.
       */
-    crc16 &operator=(const crc16 &);
+    crc16 &operator=(const crc16 &) = default;
 
     /**
       * The get method is used to obtain the running value of the cyclic
@@ -132,6 +132,19 @@ class crc16
       */
     uint16_t get() const;
 
+    /**
+      * The get_polynomial method is used to obtain the CRC polynomial
+      * being calculated with, bit reversed if the bit direction is
+      * least to most.
+      */
+    uint16_t get_polynomial() const { return polynomial; }
+
+    /**
+      * The get_bit_direction method is used to obtain the direction of
+      * bits in a character as they pass through the algorithm.
+      */
+    bit_direction_t get_bit_direction() const { return bitdir; }
+
     /**
       * The next method is used to advance the state by one byte.
       */
@@ -142,6 +155,25 @@ class crc16
       */
     void nextbuf(const void *, size_t);
 
+    /**
+      * The clear method is used to zero the running state, rather than
+      * seed it, so that this instance can work out a slice of the data
+      * for the #combine method.
+      */
+    void clear();
+
+    /**
+      * The combine method is used to advance the state as if the bytes
+      * of a later slice had been passed to #nextbuf.
+      *
+      * @param later
+      *     The checksum of the bytes immediately following those seen
+      *     so far, started with the #clear method.
+      * @param nbytes
+      *     The number of bytes seen by later.
+      */
+    void combine(const crc16 &later, size_t nbytes);
+
     /**
       * The print_table method may be used to print the table being used.
       * This is principally for debugging the table generation process.
@@ -176,16 +208,24 @@ class crc16
     bit_direction_t bitdir;
 
     /**
-      * The table instance variable is used to remember the results of 8
+      * The table instance variable is used to remember the results of
       * shift-and-process operations for each byte value.  This is used
-      * to improve efficiency.  It is filled in the the #calculate_table
-      * method, called from the constructor.
+      * to improve efficiency.  It points at rows shared by every
+      * instance with the same polynomial and bit direction, found by
+      * the #calculate_table method, called from the constructor.
+      *
+      * Row 0 holds the results of 8 shift-and-process operations (the
+      * byte value times x^16, modulo the polynomial); each row after
+      * that is a further 8 bits along (times x^24, x^32, and so on).
+      * The extra rows let #nextbuf fold four or eight bytes into the
+      * state at once.
       */
-    uint16_t table[256]{};
+    const uint16_t (*table)[256]{nullptr};
 
     /**
-      * The calculate_table method is called by the constructor to fill
-      * in the #table instance variable.
+      * The calculate_table method is called by the constructor to set
+      * the #table instance variable, building the rows if no other
+      * instance has needed them yet.
       */
     void calculate_table();
 
@@ -39,6 +39,7 @@
 
 
 #include <srecord/crc32.h>
+#include <srecord/crc_combine.h>
 
 
 static uint32_t ccitt_seed = 0xFFFFFFFF;
@@ -78,12 +79,26 @@ static uint32_t xmodem_seed = 0;
 // The values must be right-shifted by eight bits by the "UPDC32"
 // logic; the shift must be unsigned (bring in zeroes).
 //
+// Rows 1 to 15 extend the table for slicing: table[k][b] is the CRC
+// contribution of byte b followed by k zero bytes.  This lets the
+// slice-by-16 loop fold sixteen input bytes into the register with
+// sixteen independent lookups, instead of a chain of sixteen
+// dependent ones.
+//
+// The table is built the first time it is asked for.  Being a function
+// local static, that happens exactly once, even when the first callers
+// are the threads of memory::walk_parallel.
+//
+
+struct crc32_table
+{
+    crc32_table();
 
-static uint32_t table[256];
+    uint32_t row[16][256];
+};
 
 
-static void
-calculate_table()
+crc32_table::crc32_table()
 {
     for (unsigned b = 0; b < 256; ++b)
     {
@@ -91,11 +106,27 @@ calculate_table()
         int i = 8;
         for (; --i >= 0; )
             v = (v & 1) ? ((v >> 1) ^ POLYNOMIAL) : (v >> 1);
-        table[b] = v;
+        row[0][b] = v;
+    }
+    for (unsigned k = 1; k < 16; ++k)
+    {
+        for (unsigned b = 0; b < 256; ++b)
+        {
+            uint32_t v = row[k - 1][b];
+            row[k][b] = (v >> 8) ^ row[0][v & 0xFF];
+        }
     }
 }
 
 
+static const uint32_t (*
+get_table())[256]
+{
+    static const crc32_table table;
+    return table.row;
+}
+
+
 static uint32_t
 initial_state_from_seed_mode(srecord::crc32::seed_mode_t seed_mode)
 {
@@ -114,8 +145,6 @@ initial_state_from_seed_mode(srecord::crc32::seed_mode_t seed_mode)
 srecord::crc32::crc32(seed_mode_t seed_mode) :
     state(initial_state_from_seed_mode(seed_mode))
 {
-    if (!table[1])
-        calculate_table();
 }
 
 
@@ -133,7 +162,217 @@ static inline uint32_t
 UPDC32(uint8_t octet, uint32_t crc)
 {
     // The original code had this as a #define
-    return table[(crc ^ octet) & 0xFF] ^ (crc >> 8);
+    return get_table()[0][(crc ^ octet) & 0xFF] ^ (crc >> 8);
+}
+
+
+static inline uint32_t
+load_le32(const uint8_t *p)
+{
+    return
+        (
+            (uint32_t)p[0]
+        |
+            ((uint32_t)p[1] << 8)
+        |
+            ((uint32_t)p[2] << 16)
+        |
+            ((uint32_t)p[3] << 24)
+        );
+}
+
+
+/**
+  * The crc32_slice function is used to advance the CRC register over a
+  * buffer using the slicing tables; sixteen bytes at a time, then
+  * eight, then the remainder a byte at a time.
+  */
+static uint32_t
+crc32_slice(uint32_t crc, const uint8_t *dp, size_t nbytes)
+{
+    const uint32_t (*table)[256] = get_table();
+    while (nbytes >= 16)
+    {
+        uint32_t a = crc ^ load_le32(dp);
+        uint32_t b = load_le32(dp + 4);
+        uint32_t c = load_le32(dp + 8);
+        uint32_t d = load_le32(dp + 12);
+        crc =
+            table[15][a & 0xFF] ^ table[14][(a >> 8) & 0xFF]
+        ^
+            table[13][(a >> 16) & 0xFF] ^ table[12][a >> 24]
+        ^
+            table[11][b & 0xFF] ^ table[10][(b >> 8) & 0xFF]
+        ^
+            table[9][(b >> 16) & 0xFF] ^ table[8][b >> 24]
+        ^
+            table[7][c & 0xFF] ^ table[6][(c >> 8) & 0xFF]
+        ^
+            table[5][(c >> 16) & 0xFF] ^ table[4][c >> 24]
+        ^
+            table[3][d & 0xFF] ^ table[2][(d >> 8) & 0xFF]
+        ^
+            table[1][(d >> 16) & 0xFF] ^ table[0][d >> 24];
+        dp += 16;
+        nbytes -= 16;
+    }
+    if (nbytes >= 8)
+    {
+        uint32_t a = crc ^ load_le32(dp);
+        uint32_t b = load_le32(dp + 4);
+        crc =
+            table[7][a & 0xFF] ^ table[6][(a >> 8) & 0xFF]
+        ^
+            table[5][(a >> 16) & 0xFF] ^ table[4][a >> 24]
+        ^
+            table[3][b & 0xFF] ^ table[2][(b >> 8) & 0xFF]
+        ^
+            table[1][(b >> 16) & 0xFF] ^ table[0][b >> 24];
+        dp += 8;
+        nbytes -= 8;
+    }
+    while (nbytes > 0)
+    {
+        crc = table[0][(crc ^ *dp) & 0xFF] ^ (crc >> 8);
+        ++dp;
+        --nbytes;
+    }
+    return crc;
+}
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SRECORD_CRC32_CLMUL 1
+#include <immintrin.h>
+
+
+//
+// Carry-less multiply folding, after Gopal et al., "Fast CRC
+// Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+// (Intel, 2009).  The buffer is folded 64 bytes at a time into four
+// 128-bit accumulators, those are folded down to one, and the result
+// is reduced to 32 bits with a Barrett reduction.  The constants are
+// powers of x modulo the bit-reflected polynomial above.
+//
+// The buffer must be at least 64 bytes long, and a multiple of 16.
+//
+
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t
+crc32_clmul(uint32_t crc, const uint8_t *dp, size_t nbytes)
+{
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+
+    __m128i x1 = _mm_loadu_si128((const __m128i *)(dp + 0x00));
+    __m128i x2 = _mm_loadu_si128((const __m128i *)(dp + 0x10));
+    __m128i x3 = _mm_loadu_si128((const __m128i *)(dp + 0x20));
+    __m128i x4 = _mm_loadu_si128((const __m128i *)(dp + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    dp += 64;
+    nbytes -= 64;
+
+    //
+    // Fold four lanes at a time.
+    //
+    while (nbytes >= 64)
+    {
+        __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+            _mm_loadu_si128((const __m128i *)(dp + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+            _mm_loadu_si128((const __m128i *)(dp + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+            _mm_loadu_si128((const __m128i *)(dp + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+            _mm_loadu_si128((const __m128i *)(dp + 0x30)));
+        dp += 64;
+        nbytes -= 64;
+    }
+
+    //
+    // Fold the four lanes into one.
+    //
+    __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    //
+    // Fold any remaining 16 byte blocks.
+    //
+    while (nbytes >= 16)
+    {
+        x2 = _mm_loadu_si128((const __m128i *)dp);
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        dp += 16;
+        nbytes -= 16;
+    }
+
+    //
+    // Fold 128 bits down to 64 bits.
+    //
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x3 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x3, x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    //
+    // Barrett reduction down to 32 bits.
+    //
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+#endif
+
+
+typedef uint32_t (*crc32_kernel_t)(uint32_t, const uint8_t *, size_t);
+
+
+/**
+  * The crc32_kernel_select function is used to choose, once, the
+  * fastest bulk kernel this CPU can run, or none if only the table
+  * driven code is available.
+  */
+static crc32_kernel_t
+crc32_kernel_select()
+{
+#ifdef SRECORD_CRC32_CLMUL
+    __builtin_cpu_init();
+    if
+    (
+        __builtin_cpu_supports("pclmul")
+    &&
+        __builtin_cpu_supports("sse4.1")
+    )
+        return crc32_clmul;
+#endif
+    return nullptr;
 }
 
 
@@ -148,12 +387,43 @@ void
 srecord::crc32::nextbuf(const void *data, size_t nbytes)
 {
     const auto *dp = (const uint8_t *)data;
-    while (nbytes > 0)
+    static const crc32_kernel_t kernel = crc32_kernel_select();
+    if (kernel && nbytes >= 64)
     {
-        state = UPDC32(*dp, state);
-        ++dp;
-        --nbytes;
+        size_t chunk = nbytes & ~(size_t)15;
+        state = kernel(state, dp, chunk);
+        dp += chunk;
+        nbytes -= chunk;
     }
+    state = crc32_slice(state, dp, nbytes);
+}
+
+
+void
+srecord::crc32::clear()
+{
+    state = 0;
+}
+
+
+void
+srecord::crc32::combine(const crc32 &later, size_t nbytes)
+{
+    // The register is kept reflected, the combine needs it the other
+    // way around.
+    state =
+        crc_reflect
+        (
+            crc_combine
+            (
+                crc_reflect(state, 32),
+                crc_reflect(later.state, 32),
+                nbytes,
+                0x04C11DB7,
+                32
+            ),
+            32
+        );
 }
 
 
@@ -75,6 +75,25 @@ class crc32
       */
     void nextbuf(const void *, size_t);
 
+    /**
+      * The clear method is used to zero the running state, rather than
+      * seed it, so that this instance can work out a slice of the data
+      * for the #combine method.
+      */
+    void clear();
+
+    /**
+      * The combine method is used to advance the state as if the bytes
+      * of a later slice had been passed to #nextbuf.
+      *
+      * @param later
+      *     The checksum of the bytes immediately following those seen
+      *     so far, started with the #clear method.
+      * @param nbytes
+      *     The number of bytes seen by later.
+      */
+    void combine(const crc32 &later, size_t nbytes);
+
 private:
     /**
       * The state instance variable is used to remember the running
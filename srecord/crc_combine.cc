@@ -0,0 +1,122 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/crc_combine.h>
+
+
+/**
+  * The mask function is used to obtain a mask of the low width bits.
+  */
+static inline uint64_t
+mask(int width)
+{
+    return (width >= 64 ? ~(uint64_t)0 : ((uint64_t)1 << width) - 1);
+}
+
+
+/**
+  * The multiply function is used to multiply two polynomials, modulo
+  * the generator polynomial, a bit at a time.
+  */
+static uint64_t
+multiply(uint64_t a, uint64_t b, uint64_t polynomial, int width)
+{
+    uint64_t top = (uint64_t)1 << (width - 1);
+    uint64_t m = mask(width);
+    uint64_t result = 0;
+    for (uint64_t bit = top; bit; bit >>= 1)
+    {
+        bool carry = !!(result & top);
+        result = (result << 1) & m;
+        if (carry)
+            result ^= polynomial;
+        if (a & bit)
+            result ^= b;
+    }
+    return result;
+}
+
+
+/**
+  * The x_to_the function is used to work out x^n modulo the generator
+  * polynomial, by repeated squaring.
+  */
+static uint64_t
+x_to_the(uint64_t n, uint64_t polynomial, int width)
+{
+    uint64_t m = mask(width);
+
+    // x^1 needs reducing if the register is only one bit wide
+    uint64_t result = 1;
+    uint64_t square = (width > 1 ? 2 : polynomial & m);
+    for (; n; n >>= 1)
+    {
+        if (n & 1)
+            result = multiply(result, square, polynomial, width);
+        square = multiply(square, square, polynomial, width);
+    }
+    return result;
+}
+
+
+uint64_t
+srecord::crc_combine(uint64_t first, uint64_t second, uint64_t nbytes,
+    uint64_t polynomial, int width)
+{
+    polynomial &= mask(width);
+
+    //
+    // Combining the pieces of a long run usually means the same length
+    // of piece (e.g. a whole memory chunk) again and again, so the last
+    // shift worked out is remembered.
+    //
+    thread_local uint64_t last_nbytes = 0;
+    thread_local uint64_t last_polynomial = 0;
+    thread_local int last_width = 0;
+    thread_local uint64_t last_shift = 0;
+    if
+    (
+        nbytes != last_nbytes
+    ||
+        polynomial != last_polynomial
+    ||
+        width != last_width
+    )
+    {
+        last_nbytes = nbytes;
+        last_polynomial = polynomial;
+        last_width = width;
+        last_shift = x_to_the(8 * nbytes, polynomial, width);
+    }
+    return
+        (multiply(first & mask(width), last_shift, polynomial, width) ^ second);
+}
+
+
+uint64_t
+srecord::crc_reflect(uint64_t value, int width)
+{
+    uint64_t result = 0;
+    for (int j = 0; j < width; ++j)
+    {
+        result = (result << 1) | (value & 1);
+        value >>= 1;
+    }
+    return result;
+}
@@ -0,0 +1,72 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_CRC_COMBINE_H
+#define SRECORD_CRC_COMBINE_H
+
+#include <cstdint>
+
+namespace srecord
+{
+
+/**
+  * The crc_combine function is used to work out the CRC register for
+  * two series of bytes, one after the other, from the registers for
+  * each series on its own.  This lets a long CRC be calculated in
+  * slices, on several threads, and put back together afterwards.
+  *
+  * A CRC register is linear in its seed: advancing from seed s over n
+  * bytes gives s * x^(8n) mod P, plus the register the same n bytes
+  * give from a seed of zero.  The x^(8n) is worked out by repeated
+  * squaring, so the time taken grows with log(n), not n.
+  *
+  * The registers are given un-reflected, with the x^(width-1) term in
+  * bit (width - 1).  Use #crc_reflect first (and afterwards) for CRCs
+  * that keep their register reflected.
+  *
+  * @param first
+  *     The register after the first series of bytes, from whatever
+  *     seed the CRC uses.
+  * @param second
+  *     The register after the second series of bytes, from a seed of
+  *     zero.
+  * @param nbytes
+  *     The number of bytes in the second series.
+  * @param polynomial
+  *     The generator polynomial, without its x^width term.
+  * @param width
+  *     The number of bits in the register, 1 to 64.
+  */
+uint64_t crc_combine(uint64_t first, uint64_t second, uint64_t nbytes,
+    uint64_t polynomial, int width);
+
+/**
+  * The crc_reflect function is used to reverse the order of the low
+  * width bits of a value.
+  *
+  * @param value
+  *     The value to be reflected.
+  * @param width
+  *     The number of bits to be reflected, 1 to 64.
+  */
+uint64_t crc_reflect(uint64_t value, int width);
+
+};
+
+#endif // SRECORD_CRC_COMBINE_H
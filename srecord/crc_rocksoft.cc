@@ -0,0 +1,390 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include <srecord/crc_combine.h>
+#include <srecord/crc_rocksoft.h>
+#include <srecord/quit.h>
+#include <srecord/sizeof.h>
+
+
+//
+// Everything below down to the preset list is constexpr, so that the
+// tables for the presets are worked out by the compiler.  The same
+// functions build the table for a custom model at run time.
+//
+
+static constexpr uint64_t
+mask(unsigned width)
+{
+    return (width >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << width) - 1));
+}
+
+
+static constexpr uint64_t
+reflect(uint64_t x, unsigned width)
+{
+    return
+        (
+            width == 0
+        ?
+            0
+        :
+            (((x & 1) << (width - 1)) | reflect(x >> 1, width - 1))
+        );
+}
+
+
+//
+// Eight shift-and-process operations, least significant bit first,
+// with the bit reversed polynomial.
+//
+static constexpr uint64_t
+shift_reflected(uint64_t v, uint64_t rpoly, unsigned nbits)
+{
+    return
+        (
+            nbits == 0
+        ?
+            v
+        :
+            shift_reflected
+            (
+                ((v & 1) ? ((v >> 1) ^ rpoly) : (v >> 1)),
+                rpoly,
+                nbits - 1
+            )
+        );
+}
+
+
+//
+// Eight shift-and-process operations, most significant bit first, with
+// the polynomial aligned to the top of the 64 bit register.
+//
+static constexpr uint64_t
+shift_normal(uint64_t v, uint64_t apoly, unsigned nbits)
+{
+    return
+        (
+            nbits == 0
+        ?
+            v
+        :
+            shift_normal
+            (
+                ((v >> 63) ? ((v << 1) ^ apoly) : (v << 1)),
+                apoly,
+                nbits - 1
+            )
+        );
+}
+
+
+static constexpr uint64_t
+table_entry(uint64_t b, unsigned width, uint64_t poly, bool reflect_in)
+{
+    return
+        (
+            reflect_in
+        ?
+            shift_reflected(b, reflect(poly, width), 8)
+        :
+            shift_normal(b << 56, poly << (64 - width), 8)
+        );
+}
+
+
+template <size_t... I>
+struct index_list
+{
+};
+
+template <size_t N, size_t... I>
+struct make_index_list:
+    make_index_list<N - 1, N - 1, I...>
+{
+};
+
+template <size_t... I>
+struct make_index_list<0, I...>
+{
+    typedef index_list<I...> type;
+};
+
+
+/**
+  * The preset_table template is used to have the compiler work out the
+  * byte-at-a-time table for a given width, polynomial and input bit
+  * order.
+  */
+template <unsigned W, uint64_t P, bool R,
+    typename L = typename make_index_list<256>::type>
+struct preset_table;
+
+template <unsigned W, uint64_t P, bool R, size_t... I>
+struct preset_table<W, P, R, index_list<I...>>
+{
+    static constexpr uint64_t value[256] = { table_entry(I, W, P, R)... };
+};
+
+template <unsigned W, uint64_t P, bool R, size_t... I>
+constexpr uint64_t preset_table<W, P, R, index_list<I...>>::value[256];
+
+
+#define PRESET(name, w, poly, init, refin, refout, xorout, check) \
+    { name, w, poly, init, refin, refout, xorout, check, \
+        preset_table<w, poly, refin>::value }
+
+static const srecord::crc_rocksoft::model presets[] =
+{
+    PRESET("crc-8", 8, 0x07, 0, false, false, 0, 0xF4),
+    PRESET("crc-8/autosar", 8, 0x2F, 0xFF, false, false, 0xFF, 0xDF),
+    PRESET("crc-8/maxim", 8, 0x31, 0, true, true, 0, 0xA1),
+    PRESET("crc-8/sae-j1850", 8, 0x1D, 0xFF, false, false, 0xFF, 0x4B),
+    PRESET("crc-16/arc", 16, 0x8005, 0, true, true, 0, 0xBB3D),
+    PRESET("crc-16/ibm-3740", 16, 0x1021, 0xFFFF, false, false, 0, 0x29B1),
+    PRESET("crc-16/ibm-sdlc", 16, 0x1021, 0xFFFF, true, true, 0xFFFF,
+        0x906E),
+    PRESET("crc-16/kermit", 16, 0x1021, 0, true, true, 0, 0x2189),
+    PRESET("crc-16/modbus", 16, 0x8005, 0xFFFF, true, true, 0, 0x4B37),
+    PRESET("crc-16/xmodem", 16, 0x1021, 0, false, false, 0, 0x31C3),
+    PRESET("crc-32", 32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF,
+        0xCBF43926),
+    PRESET("crc-32/bzip2", 32, 0x04C11DB7, 0xFFFFFFFF, false, false,
+        0xFFFFFFFF, 0xFC891918),
+    PRESET("crc-32/cksum", 32, 0x04C11DB7, 0, false, false, 0xFFFFFFFF,
+        0x765E7680),
+    PRESET("crc-32/jamcrc", 32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0,
+        0x340BC6D9),
+    PRESET("crc-32/mpeg-2", 32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0,
+        0x0376E6E7),
+    PRESET("crc-32c", 32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF,
+        0xE3069283),
+    PRESET("crc-64/ecma-182", 64, 0x42F0E1EBA9EA3693, 0, false, false, 0,
+        0x6C40DF5F0B497347),
+    PRESET("crc-64/go-iso", 64, 0x000000000000001B, ~(uint64_t)0, true,
+        true, ~(uint64_t)0, 0xB90956C775A41001),
+    PRESET("crc-64/xz", 64, 0x42F0E1EBA9EA3693, ~(uint64_t)0, true, true,
+        ~(uint64_t)0, 0x995DC9BBDF1939FA),
+};
+
+
+//
+// The table for a custom model is built the first time it is asked
+// for, and shared by every instance calculating with the same width,
+// polynomial and bit order, so that copies (such as the slices of
+// memory::walk_parallel) carry only a pointer to it.  The lock is
+// needed because those slices may be made on other threads.
+//
+
+struct custom_table
+{
+    uint64_t row[256];
+};
+
+
+static const uint64_t *
+get_table(unsigned width, uint64_t polynomial, bool reflect_in)
+{
+    static std::mutex lock;
+    static std::map<std::tuple<unsigned, uint64_t, bool>, custom_table>
+        tables;
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto key = std::make_tuple(width, polynomial, reflect_in);
+    auto it = tables.find(key);
+    if (it == tables.end())
+    {
+        it = tables.emplace(key, custom_table()).first;
+        for (unsigned b = 0; b < 256; ++b)
+        {
+            it->second.row[b] =
+                table_entry(b, width, polynomial, reflect_in);
+        }
+    }
+    return it->second.row;
+}
+
+
+const srecord::crc_rocksoft::model *
+srecord::crc_rocksoft::model_find(const char *name)
+{
+    for (const model *mp = presets; mp < ENDOF(presets); ++mp)
+    {
+        if (0 == strcasecmp(name, mp->name))
+            return mp;
+    }
+    return 0;
+}
+
+
+std::string
+srecord::crc_rocksoft::model_names()
+{
+    std::string names;
+    for (const model *mp = presets; mp < ENDOF(presets); ++mp)
+    {
+        if (!names.empty())
+            names += ", ";
+        names += mp->name;
+    }
+    return names;
+}
+
+
+const srecord::crc_rocksoft::model &
+srecord::crc_rocksoft::model_by_name(const char *name)
+{
+    const model *mp = model_find(name);
+    if (mp)
+        return *mp;
+
+    quit_default.fatal_error
+    (
+        "CRC model name \"%s\" unknown (known names are %s)",
+        name,
+        model_names().c_str()
+    );
+    return presets[0];
+}
+
+
+srecord::crc_rocksoft::crc_rocksoft(const model &a_parameters) :
+    parameters(a_parameters),
+    state(0)
+{
+    unsigned width = parameters.width;
+    if (width < 1)
+        width = 1;
+    if (width > 64)
+        width = 64;
+    parameters.width = width;
+    parameters.polynomial &= mask(width);
+    parameters.initial &= mask(width);
+    parameters.xor_out &= mask(width);
+
+    if (!parameters.table)
+    {
+        parameters.table =
+            get_table(width, parameters.polynomial, parameters.reflect_in);
+    }
+    table = parameters.table;
+
+    if (parameters.reflect_in)
+        state = reflect(parameters.initial, width);
+    else
+        state = parameters.initial << (64 - width);
+}
+
+
+void
+srecord::crc_rocksoft::next(uint8_t c)
+{
+    if (parameters.reflect_in)
+        state = (state >> 8) ^ table[(state ^ c) & 0xFF];
+    else
+        state = (state << 8) ^ table[(state >> 56) ^ c];
+}
+
+
+void
+srecord::crc_rocksoft::nextbuf(const void *data, size_t nbytes)
+{
+    const auto *dp = (const uint8_t *)data;
+    uint64_t crc = state;
+    if (parameters.reflect_in)
+    {
+        while (nbytes > 0)
+        {
+            crc = (crc >> 8) ^ table[(crc ^ *dp++) & 0xFF];
+            --nbytes;
+        }
+    }
+    else
+    {
+        while (nbytes > 0)
+        {
+            crc = (crc << 8) ^ table[(crc >> 56) ^ *dp++];
+            --nbytes;
+        }
+    }
+    state = crc;
+}
+
+
+void
+srecord::crc_rocksoft::clear()
+{
+    state = 0;
+}
+
+
+void
+srecord::crc_rocksoft::combine(const crc_rocksoft &later, size_t nbytes)
+{
+    unsigned width = parameters.width;
+    if (parameters.reflect_in)
+    {
+        state =
+            crc_reflect
+            (
+                crc_combine
+                (
+                    crc_reflect(state, width),
+                    crc_reflect(later.state, width),
+                    nbytes,
+                    parameters.polynomial,
+                    width
+                ),
+                width
+            );
+    }
+    else
+    {
+        unsigned shift = 64 - width;
+        state =
+            crc_combine
+            (
+                state >> shift,
+                later.state >> shift,
+                nbytes,
+                parameters.polynomial,
+                width
+            )
+            << shift;
+    }
+}
+
+
+uint64_t
+srecord::crc_rocksoft::get()
+    const
+{
+    unsigned width = parameters.width;
+    uint64_t crc = (parameters.reflect_in ? state : state >> (64 - width));
+    if (parameters.reflect_in != parameters.reflect_out)
+        crc = reflect(crc, width);
+    return (crc ^ parameters.xor_out) & mask(width);
+}
@@ -0,0 +1,236 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+// The parameters follow Ross Williams' "Rocksoft^tm Model CRC
+// Algorithm", from "A painless guide to CRC error detection
+// algorithms" (1993), chapter 15; the presets and their check values
+// come from Greg Cook's "Catalogue of parametrised CRC algorithms".
+//
+
+#ifndef SRECORD_CRC_ROCKSOFT_H
+#define SRECORD_CRC_ROCKSOFT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace srecord
+{
+
+/**
+  * The crc_rocksoft class is used to represent the running value of a
+  * cyclic redundancy check of a series of bytes, of any width from 1
+  * to 64 bits, described by the parameters of the Rocksoft model.
+  *
+  * The CRC16 and CRC32 classes each compute one particular family of
+  * CRCs; this class is for everything else (CRC-32C, CRC-32/MPEG-2,
+  * CRC-64/XZ, the many CRC-8 variants, and so on).
+  */
+class crc_rocksoft
+{
+public:
+    /**
+      * The model structure is used to describe a CRC algorithm, using
+      * the parameters of the Rocksoft model.
+      */
+    struct model
+    {
+        /**
+          * The name of the algorithm, as found in the catalogue.
+          */
+        const char *name;
+
+        /**
+          * The width of the CRC, in bits, from 1 to 64.
+          */
+        unsigned width;
+
+        /**
+          * The polynomial, without its top (x^width) term, with the
+          * x^0 term in the least significant bit.
+          */
+        uint64_t polynomial;
+
+        /**
+          * The initial value of the register.
+          */
+        uint64_t initial;
+
+        /**
+          * Whether each input byte is processed least significant bit
+          * first.
+          */
+        bool reflect_in;
+
+        /**
+          * Whether the final register value is bit reversed.
+          */
+        bool reflect_out;
+
+        /**
+          * The value to exclusive-or with the final register value.
+          */
+        uint64_t xor_out;
+
+        /**
+          * The CRC of the nine ASCII characters "123456789".
+          */
+        uint64_t check;
+
+        /**
+          * The byte-at-a-time table, if it was worked out at compile
+          * time, or NULL if it is to be calculated by the constructor.
+          */
+        const uint64_t *table;
+    };
+
+    /**
+      * The model_by_name class method is used to look up one of the
+      * preset CRC algorithms by name.  The name is not case sensitive.
+      * It is a fatal error if the name is not known.
+      */
+    static const model &model_by_name(const char *name);
+
+    /**
+      * The model_find class method is used to look up one of the
+      * preset CRC algorithms by name.  The name is not case sensitive.
+      *
+      * @returns
+      *     the preset, or NULL if the name is not known.
+      */
+    static const model *model_find(const char *name);
+
+    /**
+      * The model_names class method is used to obtain the names of all
+      * of the preset CRC algorithms, separated by commas, for error
+      * messages.
+      */
+    static std::string model_names();
+
+    /**
+      * The destructor.
+      */
+    virtual ~crc_rocksoft() = default;
+
+    /**
+      * The constructor.
+      *
+      * @param parameters
+      *     The CRC algorithm to be calculated.  The width must be
+      *     between 1 and 64; the other values are masked to that
+      *     width.
+      */
+    crc_rocksoft(const model &parameters);
+
+    /**
+      * The get method is used to obtain the running value of the cyclic
+      * redundancy check.
+      */
+    uint64_t get() const;
+
+    /**
+      * The get_width method is used to obtain the width of the cyclic
+      * redundancy check, in bits.
+      */
+    unsigned get_width() const { return parameters.width; }
+
+    /**
+      * The get_name method is used to obtain the name of the CRC
+      * algorithm.
+      */
+    const char *get_name() const { return parameters.name; }
+
+    /**
+      * The get_model method is used to obtain the parameters of the
+      * CRC algorithm.
+      */
+    const model &get_model() const { return parameters; }
+
+    /**
+      * The next method is used to advance the state by one byte.
+      */
+    void next(uint8_t);
+
+    /**
+      * The nextbuf method is used to advance the state by a series of bytes.
+      */
+    void nextbuf(const void *, size_t);
+
+    /**
+      * The clear method is used to zero the running state, rather than
+      * seed it, so that this instance can work out a slice of the data
+      * for the #combine method.
+      */
+    void clear();
+
+    /**
+      * The combine method is used to advance the state as if the bytes
+      * of a later slice had been passed to #nextbuf.
+      *
+      * @param later
+      *     The checksum of the bytes immediately following those seen
+      *     so far, started with the #clear method.
+      * @param nbytes
+      *     The number of bytes seen by later.
+      */
+    void combine(const crc_rocksoft &later, size_t nbytes);
+
+private:
+    /**
+      * The parameters instance variable is used to remember the CRC
+      * algorithm being calculated, masked to its width.
+      */
+    model parameters;
+
+    /**
+      * The table instance variable is used to remember the results of
+      * eight shift-and-process operations for each byte value.  For
+      * reflected algorithms the register is kept in the least
+      * significant bits; otherwise it is kept in the most significant
+      * bits, so that the same shifts work for every width.  It points
+      * at a table shared by every instance calculating the same
+      * algorithm.
+      */
+    const uint64_t *table;
+
+    /**
+      * The state instance variable is used to remember the running
+      * value of the register, aligned as described for #table.
+      */
+    uint64_t state;
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    crc_rocksoft() = delete;
+
+    /**
+      * The copy constructor.
+      */
+    crc_rocksoft(const crc_rocksoft &) = default;
+
+    /**
+      * The assignment operator.
+      */
+    crc_rocksoft &operator=(const crc_rocksoft &) = default;
+};
+
+};
+
+#endif // SRECORD_CRC_ROCKSOFT_H
@@ -0,0 +1,76 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+#include <string>
+
+#include <srecord/digest.h>
+#include <srecord/digest/md5.h>
+#include <srecord/digest/sha1.h>
+#include <srecord/digest/sha256.h>
+#include <srecord/digest/sha512.h>
+#include <srecord/sizeof.h>
+
+
+srecord::digest::~digest() = default;
+
+
+struct digest_table_t
+{
+    const char *name;
+    srecord::digest::pointer (*create)();
+};
+
+static const digest_table_t digest_table[] =
+{
+    { "MD5", &srecord::digest_md5::create },
+    { "SHA1", &srecord::digest_sha1::create },
+    { "SHA224", &srecord::digest_sha256::create_sha224 },
+    { "SHA256", &srecord::digest_sha256::create },
+    { "SHA384", &srecord::digest_sha512::create_sha384 },
+    { "SHA512", &srecord::digest_sha512::create },
+};
+
+
+srecord::digest::pointer
+srecord::digest::create(const char *name)
+{
+    for (const digest_table_t *tp = digest_table; tp < ENDOF(digest_table);
+        ++tp)
+    {
+        if (0 == strcasecmp(name, tp->name))
+            return tp->create();
+    }
+    return pointer();
+}
+
+
+std::string
+srecord::digest::get_names()
+{
+    std::string names;
+    for (const digest_table_t *tp = digest_table; tp < ENDOF(digest_table);
+        ++tp)
+    {
+        if (!names.empty())
+            names += ", ";
+        names += tp->name;
+    }
+    return names;
+}
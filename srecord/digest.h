@@ -0,0 +1,121 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_DIGEST_H
+#define SRECORD_DIGEST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace srecord
+{
+
+/**
+  * The srecord::digest class is used to represent an abstract message
+  * digest (cryptographic hash) calculation.  These are the digests
+  * SRecord has built in, so that the common ones work without the
+  * libgcrypt library.
+  */
+class digest
+{
+public:
+    /**
+      * The pointer type is to be used for all pointers to digests.
+      */
+    typedef std::shared_ptr<digest> pointer;
+
+    /**
+      * The destructor.
+      */
+    virtual ~digest();
+
+    /**
+      * The create class method is used to create a new dynamically
+      * allocated digest, given its name.  The name is not case
+      * sensitive, and is the same as libgcrypt would use ("MD5",
+      * "SHA1", "SHA224", "SHA256", "SHA384" or "SHA512").
+      *
+      * @returns
+      *     the new digest, or NULL if the name is not one of the
+      *     built in digests.
+      */
+    static pointer create(const char *name);
+
+    /**
+      * The get_names class method is used to obtain the names of all
+      * of the built in digests, separated by commas, for error
+      * messages.
+      */
+    static std::string get_names();
+
+    /**
+      * The nextbuf method is used to advance the calculation by a
+      * series of bytes.
+      *
+      * @param data
+      *     The base address of the bytes to be digested.
+      * @param nbytes
+      *     The number of bytes to be digested.
+      */
+    virtual void nextbuf(const void *data, size_t nbytes) = 0;
+
+    /**
+      * The get method is used to obtain the digest of all of the bytes
+      * seen so far.
+      *
+      * @param result
+      *     Where to put the digest, #get_size bytes of it.
+      */
+    virtual void get(uint8_t *result) const = 0;
+
+    /**
+      * The get_size method is used to obtain the size of the digest,
+      * in bytes.
+      */
+    virtual size_t get_size() const = 0;
+
+    /**
+      * The get_name method is used to obtain the name of the digest,
+      * for use in error messages.
+      */
+    virtual const char *get_name() const = 0;
+
+protected:
+    /**
+      * The default constructor.  May only be called by derived classes.
+      */
+    digest() = default;
+
+public:
+    /**
+      * The copy constructor.  Do not use.
+      */
+    digest(const digest &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    digest &operator=(const digest &) = delete;
+};
+
+};
+
+#endif // SRECORD_DIGEST_H
@@ -0,0 +1,239 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+
+#include <srecord/digest/md5.h>
+
+
+//
+// The round constants, the integer part of 2^32 times the sine of the
+// round number (counting from one), and the left rotations of each
+// round.
+//
+static const uint32_t K[64] =
+{
+    0xD76AA478, 0xE8C7B756, 0x242070DB, 0xC1BDCEEE,
+    0xF57C0FAF, 0x4787C62A, 0xA8304613, 0xFD469501,
+    0x698098D8, 0x8B44F7AF, 0xFFFF5BB1, 0x895CD7BE,
+    0x6B901122, 0xFD987193, 0xA679438E, 0x49B40821,
+    0xF61E2562, 0xC040B340, 0x265E5A51, 0xE9B6C7AA,
+    0xD62F105D, 0x02441453, 0xD8A1E681, 0xE7D3FBC8,
+    0x21E1CDE6, 0xC33707D6, 0xF4D50D87, 0x455A14ED,
+    0xA9E3E905, 0xFCEFA3F8, 0x676F02D9, 0x8D2A4C8A,
+    0xFFFA3942, 0x8771F681, 0x6D9D6122, 0xFDE5380C,
+    0xA4BEEA44, 0x4BDECFA9, 0xF6BB4B60, 0xBEBFBC70,
+    0x289B7EC6, 0xEAA127FA, 0xD4EF3085, 0x04881D05,
+    0xD9D4D039, 0xE6DB99E5, 0x1FA27CF8, 0xC4AC5665,
+    0xF4292244, 0x432AFF97, 0xAB9423A7, 0xFC93A039,
+    0x655B59C3, 0x8F0CCC92, 0xFFEFF47D, 0x85845DD1,
+    0x6FA87E4F, 0xFE2CE6E0, 0xA3014314, 0x4E0811A1,
+    0xF7537E82, 0xBD3AF235, 0x2AD7D2BB, 0xEB86D391,
+};
+
+static const uint8_t R[64] =
+{
+    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+    5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21,
+};
+
+
+static inline uint32_t
+load_le32(const uint8_t *p)
+{
+    return
+        (
+            (uint32_t)p[0]
+        |
+            ((uint32_t)p[1] << 8)
+        |
+            ((uint32_t)p[2] << 16)
+        |
+            ((uint32_t)p[3] << 24)
+        );
+}
+
+
+static inline void
+store_le32(uint8_t *p, uint32_t x)
+{
+    p[0] = x;
+    p[1] = x >> 8;
+    p[2] = x >> 16;
+    p[3] = x >> 24;
+}
+
+
+static inline uint32_t
+rol(uint32_t x, int n)
+{
+    return ((x << n) | (x >> (32 - n)));
+}
+
+
+/**
+  * The md5_blocks function is used to digest whole 64 byte blocks, the
+  * way RFC 1321 describes it.
+  */
+static void
+md5_blocks(uint32_t *state, const uint8_t *dp, size_t nblocks)
+{
+    for (; nblocks > 0; --nblocks, dp += 64)
+    {
+        uint32_t m[16];
+        for (int j = 0; j < 16; ++j)
+            m[j] = load_le32(dp + 4 * j);
+
+        uint32_t a = state[0];
+        uint32_t b = state[1];
+        uint32_t c = state[2];
+        uint32_t d = state[3];
+        for (int j = 0; j < 64; ++j)
+        {
+            uint32_t f;
+            int g;
+            if (j < 16)
+            {
+                f = (b & c) | (~b & d);
+                g = j;
+            }
+            else if (j < 32)
+            {
+                f = (d & b) | (~d & c);
+                g = (5 * j + 1) % 16;
+            }
+            else if (j < 48)
+            {
+                f = b ^ c ^ d;
+                g = (3 * j + 5) % 16;
+            }
+            else
+            {
+                f = c ^ (b | ~d);
+                g = (7 * j) % 16;
+            }
+            f += a + K[j] + m[g];
+            a = d;
+            d = c;
+            c = b;
+            b += rol(f, R[j]);
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+    }
+}
+
+
+srecord::digest_md5::digest_md5() :
+    state{ 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476 }
+{
+}
+
+
+srecord::digest::pointer
+srecord::digest_md5::create()
+{
+    return pointer(new digest_md5());
+}
+void
+srecord::digest_md5::nextbuf(const void *data, size_t nbytes)
+{
+    const auto *dp = (const uint8_t *)data;
+    size_t used = length % sizeof(buffer);
+    length += nbytes;
+
+    //
+    // Finish off any block left over from last time.
+    //
+    if (used > 0)
+    {
+        size_t n = sizeof(buffer) - used;
+        if (n > nbytes)
+            n = nbytes;
+        memcpy(buffer + used, dp, n);
+        dp += n;
+        nbytes -= n;
+        if (used + n < sizeof(buffer))
+            return;
+        md5_blocks(state, buffer, 1);
+    }
+
+    //
+    // Then as many whole blocks as there are, straight from the
+    // caller's buffer.
+    //
+    size_t nblocks = nbytes / sizeof(buffer);
+    if (nblocks > 0)
+    {
+        md5_blocks(state, dp, nblocks);
+        dp += nblocks * sizeof(buffer);
+        nbytes -= nblocks * sizeof(buffer);
+    }
+
+    //
+    // Keep the rest for next time.
+    //
+    memcpy(buffer, dp, nbytes);
+}
+
+
+void
+srecord::digest_md5::get(uint8_t *result)
+    const
+{
+    //
+    // Pad a copy of the partial block with a one bit, zeros, and the
+    // length in bits, to make one or two more blocks.
+    //
+    uint32_t h[4];
+    memcpy(h, state, sizeof(h));
+    size_t used = length % sizeof(buffer);
+    uint8_t tail[2 * sizeof(buffer)]{};
+    memcpy(tail, buffer, used);
+    tail[used] = 0x80;
+    size_t tail_size = (used < 56 ? 64 : 128);
+    uint64_t bits = length * 8;
+    store_le32(tail + tail_size - 8, bits);
+    store_le32(tail + tail_size - 4, bits >> 32);
+    md5_blocks(h, tail, tail_size / 64);
+
+    size_t nwords = get_size() / 4;
+    for (size_t j = 0; j < nwords; ++j)
+        store_le32(result + 4 * j, h[j]);
+}
+
+
+size_t
+srecord::digest_md5::get_size()
+    const
+{
+    return 16;
+}
+
+
+const char *
+srecord::digest_md5::get_name()
+    const
+{
+    return "MD5";
+}
@@ -0,0 +1,98 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_DIGEST_MD5_H
+#define SRECORD_DIGEST_MD5_H
+
+#include <srecord/digest.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::digest_md5 class is used to represent the calculation
+  * of an MD5 message digest, as described in RFC 1321.
+  */
+class digest_md5:
+    public digest
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~digest_md5() override = default;
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      */
+    static pointer create();
+
+    // See base class for documentation.
+    void nextbuf(const void *data, size_t nbytes) override;
+
+    // See base class for documentation.
+    void get(uint8_t *result) const override;
+
+    // See base class for documentation.
+    size_t get_size() const override;
+
+    // See base class for documentation.
+    const char *get_name() const override;
+
+private:
+    /**
+      * The default constructor.  It is private on purpose, use the
+      * #create class method instead.
+      */
+    digest_md5();
+
+    /**
+      * The state instance variable is used to remember the four words
+      * of the running hash.
+      */
+    uint32_t state[4];
+
+    /**
+      * The length instance variable is used to remember the number of
+      * bytes digested so far.
+      */
+    uint64_t length{0};
+
+    /**
+      * The buffer instance variable is used to remember the bytes of a
+      * partial block, until the rest of the block arrives.
+      */
+    uint8_t buffer[64]{};
+
+public:
+    /**
+      * The copy constructor.  Do not use.
+      */
+    digest_md5(const digest_md5 &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    digest_md5 &operator=(const digest_md5 &) = delete;
+};
+
+};
+
+#endif // SRECORD_DIGEST_MD5_H
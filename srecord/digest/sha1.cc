@@ -0,0 +1,343 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+
+#include <srecord/digest/sha1.h>
+
+
+static inline uint32_t
+load_be32(const uint8_t *p)
+{
+    return
+        (
+            ((uint32_t)p[0] << 24)
+        |
+            ((uint32_t)p[1] << 16)
+        |
+            ((uint32_t)p[2] << 8)
+        |
+            (uint32_t)p[3]
+        );
+}
+
+
+static inline void
+store_be32(uint8_t *p, uint32_t x)
+{
+    p[0] = x >> 24;
+    p[1] = x >> 16;
+    p[2] = x >> 8;
+    p[3] = x;
+}
+
+
+static inline uint32_t
+rol(uint32_t x, int n)
+{
+    return ((x << n) | (x >> (32 - n)));
+}
+
+
+/**
+  * The sha1_blocks_portable function is used to digest whole 64 byte
+  * blocks, the way FIPS 180-4 describes it.
+  */
+static void
+sha1_blocks_portable(uint32_t *state, const uint8_t *dp, size_t nblocks)
+{
+    for (; nblocks > 0; --nblocks, dp += 64)
+    {
+        uint32_t w[80];
+        for (int t = 0; t < 16; ++t)
+            w[t] = load_be32(dp + 4 * t);
+        for (int t = 16; t < 80; ++t)
+            w[t] = rol(w[t - 3] ^ w[t - 8] ^ w[t - 14] ^ w[t - 16], 1);
+
+        uint32_t a = state[0];
+        uint32_t b = state[1];
+        uint32_t c = state[2];
+        uint32_t d = state[3];
+        uint32_t e = state[4];
+        for (int t = 0; t < 80; ++t)
+        {
+            uint32_t f;
+            uint32_t k;
+            if (t < 20)
+            {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999;
+            }
+            else if (t < 40)
+            {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            }
+            else if (t < 60)
+            {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            }
+            else
+            {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+            uint32_t temp = rol(a, 5) + f + e + k + w[t];
+            e = d;
+            d = c;
+            c = rol(b, 30);
+            b = a;
+            a = temp;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+    }
+}
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SRECORD_SHA1_SHANI 1
+#include <immintrin.h>
+
+
+//
+// The same thing, using the x86 SHA extensions.  Each group of four
+// rounds folds the next four message words into E (alternately e[0]
+// and e[1], one holding E for this group while the other saves A for
+// the next), and (for groups 1 to 18) works out more of the message
+// schedule as it goes, four words at a time.
+//
+// After Intel, "Intel SHA Extensions" (2013).
+//
+
+#define SHA1_GROUP(g)                                                   \
+    {                                                                   \
+        if ((g) < 4)                                                    \
+        {                                                               \
+            msg[(g) % 4] =                                              \
+                _mm_shuffle_epi8                                        \
+                (                                                       \
+                    _mm_loadu_si128((const __m128i *)(dp + 16 * (g))),  \
+                    mask                                                \
+                );                                                      \
+        }                                                               \
+        if ((g) == 0)                                                   \
+            e[0] = _mm_add_epi32(e[0], msg[0]);                         \
+        else                                                            \
+            e[(g) & 1] = _mm_sha1nexte_epu32(e[(g) & 1], msg[(g) % 4]); \
+        e[((g) + 1) & 1] = abcd;                                        \
+        if ((g) >= 3 && (g) <= 18)                                      \
+        {                                                               \
+            msg[((g) + 1) % 4] =                                        \
+                _mm_sha1msg2_epu32(msg[((g) + 1) % 4], msg[(g) % 4]);   \
+        }                                                               \
+        abcd = _mm_sha1rnds4_epu32(abcd, e[(g) & 1], (g) / 5);          \
+        if ((g) >= 1 && (g) <= 16)                                      \
+        {                                                               \
+            msg[((g) + 3) % 4] =                                        \
+                _mm_sha1msg1_epu32(msg[((g) + 3) % 4], msg[(g) % 4]);   \
+        }                                                               \
+        if ((g) >= 2 && (g) <= 17)                                      \
+        {                                                               \
+            msg[((g) + 2) % 4] =                                        \
+                _mm_xor_si128(msg[((g) + 2) % 4], msg[(g) % 4]);        \
+        }                                                               \
+    }
+
+__attribute__((target("sha,sse4.1")))
+static void
+sha1_blocks_shani(uint32_t *state, const uint8_t *dp, size_t nblocks)
+{
+    const __m128i mask =
+        _mm_set_epi64x(0x0001020304050607, 0x08090A0B0C0D0E0F);
+
+    __m128i abcd = _mm_loadu_si128((const __m128i *)state);
+    abcd = _mm_shuffle_epi32(abcd, 0x1B);
+    __m128i e0 = _mm_set_epi32((int)state[4], 0, 0, 0);
+
+    for (; nblocks > 0; --nblocks, dp += 64)
+    {
+        __m128i abcd_save = abcd;
+        __m128i e[2] = { e0, e0 };
+        __m128i msg[4];
+
+        SHA1_GROUP(0)
+        SHA1_GROUP(1)
+        SHA1_GROUP(2)
+        SHA1_GROUP(3)
+        SHA1_GROUP(4)
+        SHA1_GROUP(5)
+        SHA1_GROUP(6)
+        SHA1_GROUP(7)
+        SHA1_GROUP(8)
+        SHA1_GROUP(9)
+        SHA1_GROUP(10)
+        SHA1_GROUP(11)
+        SHA1_GROUP(12)
+        SHA1_GROUP(13)
+        SHA1_GROUP(14)
+        SHA1_GROUP(15)
+        SHA1_GROUP(16)
+        SHA1_GROUP(17)
+        SHA1_GROUP(18)
+        SHA1_GROUP(19)
+
+        e0 = _mm_sha1nexte_epu32(e[0], e0);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    abcd = _mm_shuffle_epi32(abcd, 0x1B);
+    _mm_storeu_si128((__m128i *)state, abcd);
+    state[4] = _mm_extract_epi32(e0, 3);
+}
+
+#undef SHA1_GROUP
+
+#endif
+
+
+typedef void (*sha1_blocks_t)(uint32_t *, const uint8_t *, size_t);
+
+
+/**
+  * The sha1_blocks_select function is used to choose, once, the
+  * fastest way this CPU has of digesting whole blocks.
+  */
+static sha1_blocks_t
+sha1_blocks_select()
+{
+#ifdef SRECORD_SHA1_SHANI
+    __builtin_cpu_init();
+    if
+    (
+        __builtin_cpu_supports("sha")
+    &&
+        __builtin_cpu_supports("sse4.1")
+    )
+        return sha1_blocks_shani;
+#endif
+    return sha1_blocks_portable;
+}
+
+
+static void
+sha1_blocks(uint32_t *state, const uint8_t *dp, size_t nblocks)
+{
+    static const sha1_blocks_t blocks = sha1_blocks_select();
+    blocks(state, dp, nblocks);
+}
+
+
+srecord::digest_sha1::digest_sha1() :
+    state{ 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 }
+{
+}
+
+
+srecord::digest::pointer
+srecord::digest_sha1::create()
+{
+    return pointer(new digest_sha1());
+}
+void
+srecord::digest_sha1::nextbuf(const void *data, size_t nbytes)
+{
+    const auto *dp = (const uint8_t *)data;
+    size_t used = length % sizeof(buffer);
+    length += nbytes;
+
+    //
+    // Finish off any block left over from last time.
+    //
+    if (used > 0)
+    {
+        size_t n = sizeof(buffer) - used;
+        if (n > nbytes)
+            n = nbytes;
+        memcpy(buffer + used, dp, n);
+        dp += n;
+        nbytes -= n;
+        if (used + n < sizeof(buffer))
+            return;
+        sha1_blocks(state, buffer, 1);
+    }
+
+    //
+    // Then as many whole blocks as there are, straight from the
+    // caller's buffer.
+    //
+    size_t nblocks = nbytes / sizeof(buffer);
+    if (nblocks > 0)
+    {
+        sha1_blocks(state, dp, nblocks);
+        dp += nblocks * sizeof(buffer);
+        nbytes -= nblocks * sizeof(buffer);
+    }
+
+    //
+    // Keep the rest for next time.
+    //
+    memcpy(buffer, dp, nbytes);
+}
+
+
+void
+srecord::digest_sha1::get(uint8_t *result)
+    const
+{
+    //
+    // Pad a copy of the partial block with a one bit, zeros, and the
+    // length in bits, to make one or two more blocks.
+    //
+    uint32_t h[5];
+    memcpy(h, state, sizeof(h));
+    size_t used = length % sizeof(buffer);
+    uint8_t tail[2 * sizeof(buffer)]{};
+    memcpy(tail, buffer, used);
+    tail[used] = 0x80;
+    size_t tail_size = (used < 56 ? 64 : 128);
+    uint64_t bits = length * 8;
+    store_be32(tail + tail_size - 8, bits >> 32);
+    store_be32(tail + tail_size - 4, bits);
+    sha1_blocks(h, tail, tail_size / 64);
+
+    size_t nwords = get_size() / 4;
+    for (size_t j = 0; j < nwords; ++j)
+        store_be32(result + 4 * j, h[j]);
+}
+
+
+size_t
+srecord::digest_sha1::get_size()
+    const
+{
+    return 20;
+}
+
+
+const char *
+srecord::digest_sha1::get_name()
+    const
+{
+    return "SHA1";
+}
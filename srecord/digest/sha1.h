@@ -0,0 +1,99 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_DIGEST_SHA1_H
+#define SRECORD_DIGEST_SHA1_H
+
+#include <srecord/digest.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::digest_sha1 class is used to represent the calculation
+  * of a SHA-1 message digest, as described in FIPS 180-4.  It uses the
+  * x86 SHA extensions, if the CPU has them.
+  */
+class digest_sha1:
+    public digest
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~digest_sha1() override = default;
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      */
+    static pointer create();
+
+    // See base class for documentation.
+    void nextbuf(const void *data, size_t nbytes) override;
+
+    // See base class for documentation.
+    void get(uint8_t *result) const override;
+
+    // See base class for documentation.
+    size_t get_size() const override;
+
+    // See base class for documentation.
+    const char *get_name() const override;
+
+private:
+    /**
+      * The default constructor.  It is private on purpose, use the
+      * #create class method instead.
+      */
+    digest_sha1();
+
+    /**
+      * The state instance variable is used to remember the five words
+      * of the running hash.
+      */
+    uint32_t state[5];
+
+    /**
+      * The length instance variable is used to remember the number of
+      * bytes digested so far.
+      */
+    uint64_t length{0};
+
+    /**
+      * The buffer instance variable is used to remember the bytes of a
+      * partial block, until the rest of the block arrives.
+      */
+    uint8_t buffer[64]{};
+
+public:
+    /**
+      * The copy constructor.  Do not use.
+      */
+    digest_sha1(const digest_sha1 &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    digest_sha1 &operator=(const digest_sha1 &) = delete;
+};
+
+};
+
+#endif // SRECORD_DIGEST_SHA1_H
@@ -0,0 +1,408 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+
+#include <srecord/digest/sha256.h>
+
+
+//
+// The round constants, the first 32 bits of the fractional parts of
+// the cube roots of the first 64 primes.
+//
+static const uint32_t K[64] =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+    0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+    0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+    0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+    0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+    0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+    0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+    0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+    0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+
+//
+// The initial hash values for SHA-256 and SHA-224.
+//
+static const uint32_t sha256_initial[8] =
+{
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+
+static const uint32_t sha224_initial[8] =
+{
+    0xC1059ED8, 0x367CD507, 0x3070DD17, 0xF70E5939,
+    0xFFC00B31, 0x68581511, 0x64F98FA7, 0xBEFA4FA4,
+};
+
+
+static inline uint32_t
+load_be32(const uint8_t *p)
+{
+    return
+        (
+            ((uint32_t)p[0] << 24)
+        |
+            ((uint32_t)p[1] << 16)
+        |
+            ((uint32_t)p[2] << 8)
+        |
+            (uint32_t)p[3]
+        );
+}
+
+
+static inline void
+store_be32(uint8_t *p, uint32_t x)
+{
+    p[0] = x >> 24;
+    p[1] = x >> 16;
+    p[2] = x >> 8;
+    p[3] = x;
+}
+
+
+static inline uint32_t
+ror(uint32_t x, int n)
+{
+    return ((x >> n) | (x << (32 - n)));
+}
+
+
+/**
+  * The sha256_blocks_portable function is used to digest whole 64 byte
+  * blocks, the way FIPS 180-4 describes it.
+  */
+static void
+sha256_blocks_portable(uint32_t *state, const uint8_t *dp, size_t nblocks)
+{
+    for (; nblocks > 0; --nblocks, dp += 64)
+    {
+        uint32_t w[64];
+        for (int t = 0; t < 16; ++t)
+            w[t] = load_be32(dp + 4 * t);
+        for (int t = 16; t < 64; ++t)
+        {
+            uint32_t s0 =
+                ror(w[t - 15], 7) ^ ror(w[t - 15], 18) ^ (w[t - 15] >> 3);
+            uint32_t s1 =
+                ror(w[t - 2], 17) ^ ror(w[t - 2], 19) ^ (w[t - 2] >> 10);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+
+        uint32_t a = state[0];
+        uint32_t b = state[1];
+        uint32_t c = state[2];
+        uint32_t d = state[3];
+        uint32_t e = state[4];
+        uint32_t f = state[5];
+        uint32_t g = state[6];
+        uint32_t h = state[7];
+        for (int t = 0; t < 64; ++t)
+        {
+            uint32_t t1 =
+                h
+            +
+                (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25))
+            +
+                ((e & f) ^ (~e & g))
+            +
+                K[t]
+            +
+                w[t];
+            uint32_t t2 =
+                (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22))
+            +
+                ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SRECORD_SHA256_SHANI 1
+#include <immintrin.h>
+
+
+//
+// The same thing, using the x86 SHA extensions.  The state is kept as
+// two vectors, ABEF and CDGH, which is how the sha256rnds2 instruction
+// wants it.  Each group of four rounds adds the next four message
+// words to the round constants, and (for groups 1 to 14) works out
+// more of the message schedule as it goes, four words at a time.
+//
+// After Intel, "Intel SHA Extensions" (2013).
+//
+
+#define SHA256_GROUP(g)                                                 \
+    {                                                                   \
+        if ((g) < 4)                                                    \
+        {                                                               \
+            msg[(g) % 4] =                                              \
+                _mm_shuffle_epi8                                        \
+                (                                                       \
+                    _mm_loadu_si128((const __m128i *)(dp + 16 * (g))),  \
+                    mask                                                \
+                );                                                      \
+        }                                                               \
+        __m128i m =                                                     \
+            _mm_add_epi32                                               \
+            (                                                           \
+                msg[(g) % 4],                                           \
+                _mm_loadu_si128((const __m128i *)(K + 4 * (g)))         \
+            );                                                          \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, m);              \
+        if ((g) >= 3 && (g) <= 14)                                      \
+        {                                                               \
+            __m128i tmp =                                               \
+                _mm_alignr_epi8(msg[(g) % 4], msg[((g) + 3) % 4], 4);   \
+            msg[((g) + 1) % 4] = _mm_add_epi32(msg[((g) + 1) % 4], tmp); \
+            msg[((g) + 1) % 4] =                                        \
+                _mm_sha256msg2_epu32(msg[((g) + 1) % 4], msg[(g) % 4]); \
+        }                                                               \
+        m = _mm_shuffle_epi32(m, 0x0E);                                 \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, m);              \
+        if ((g) >= 1 && (g) <= 12)                                      \
+        {                                                               \
+            msg[((g) + 3) % 4] =                                        \
+                _mm_sha256msg1_epu32(msg[((g) + 3) % 4], msg[(g) % 4]); \
+        }                                                               \
+    }
+
+__attribute__((target("sha,sse4.1")))
+static void
+sha256_blocks_shani(uint32_t *state, const uint8_t *dp, size_t nblocks)
+{
+    const __m128i mask =
+        _mm_set_epi64x(0x0C0D0E0F08090A0B, 0x0405060700010203);
+
+    __m128i tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);            // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B);      // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);   // CDGH
+
+    for (; nblocks > 0; --nblocks, dp += 64)
+    {
+        __m128i abef_save = state0;
+        __m128i cdgh_save = state1;
+        __m128i msg[4];
+
+        SHA256_GROUP(0)
+        SHA256_GROUP(1)
+        SHA256_GROUP(2)
+        SHA256_GROUP(3)
+        SHA256_GROUP(4)
+        SHA256_GROUP(5)
+        SHA256_GROUP(6)
+        SHA256_GROUP(7)
+        SHA256_GROUP(8)
+        SHA256_GROUP(9)
+        SHA256_GROUP(10)
+        SHA256_GROUP(11)
+        SHA256_GROUP(12)
+        SHA256_GROUP(13)
+        SHA256_GROUP(14)
+        SHA256_GROUP(15)
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);         // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);      // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);   // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);      // HGFE
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+#undef SHA256_GROUP
+
+#endif
+
+
+typedef void (*sha256_blocks_t)(uint32_t *, const uint8_t *, size_t);
+
+
+/**
+  * The sha256_blocks_select function is used to choose, once, the
+  * fastest way this CPU has of digesting whole blocks.
+  */
+static sha256_blocks_t
+sha256_blocks_select()
+{
+#ifdef SRECORD_SHA256_SHANI
+    __builtin_cpu_init();
+    if
+    (
+        __builtin_cpu_supports("sha")
+    &&
+        __builtin_cpu_supports("sse4.1")
+    )
+        return sha256_blocks_shani;
+#endif
+    return sha256_blocks_portable;
+}
+
+
+static void
+sha256_blocks(uint32_t *state, const uint8_t *dp, size_t nblocks)
+{
+    static const sha256_blocks_t blocks = sha256_blocks_select();
+    blocks(state, dp, nblocks);
+}
+
+
+srecord::digest_sha256::digest_sha256(bool a_sha224) :
+    sha224(a_sha224)
+{
+    memcpy
+    (
+        state,
+        (sha224 ? sha224_initial : sha256_initial),
+        sizeof(state)
+    );
+}
+
+
+srecord::digest::pointer
+srecord::digest_sha256::create()
+{
+    return pointer(new digest_sha256(false));
+}
+
+
+srecord::digest::pointer
+srecord::digest_sha256::create_sha224()
+{
+    return pointer(new digest_sha256(true));
+}
+
+
+void
+srecord::digest_sha256::nextbuf(const void *data, size_t nbytes)
+{
+    const auto *dp = (const uint8_t *)data;
+    size_t used = length % sizeof(buffer);
+    length += nbytes;
+
+    //
+    // Finish off any block left over from last time.
+    //
+    if (used > 0)
+    {
+        size_t n = sizeof(buffer) - used;
+        if (n > nbytes)
+            n = nbytes;
+        memcpy(buffer + used, dp, n);
+        dp += n;
+        nbytes -= n;
+        if (used + n < sizeof(buffer))
+            return;
+        sha256_blocks(state, buffer, 1);
+    }
+
+    //
+    // Then as many whole blocks as there are, straight from the
+    // caller's buffer.
+    //
+    size_t nblocks = nbytes / sizeof(buffer);
+    if (nblocks > 0)
+    {
+        sha256_blocks(state, dp, nblocks);
+        dp += nblocks * sizeof(buffer);
+        nbytes -= nblocks * sizeof(buffer);
+    }
+
+    //
+    // Keep the rest for next time.
+    //
+    memcpy(buffer, dp, nbytes);
+}
+
+
+void
+srecord::digest_sha256::get(uint8_t *result)
+    const
+{
+    //
+    // Pad a copy of the partial block with a one bit, zeros, and the
+    // length in bits, to make one or two more blocks.
+    //
+    uint32_t h[8];
+    memcpy(h, state, sizeof(h));
+    size_t used = length % sizeof(buffer);
+    uint8_t tail[2 * sizeof(buffer)]{};
+    memcpy(tail, buffer, used);
+    tail[used] = 0x80;
+    size_t tail_size = (used < 56 ? 64 : 128);
+    uint64_t bits = length * 8;
+    store_be32(tail + tail_size - 8, bits >> 32);
+    store_be32(tail + tail_size - 4, bits);
+    sha256_blocks(h, tail, tail_size / 64);
+
+    size_t nwords = get_size() / 4;
+    for (size_t j = 0; j < nwords; ++j)
+        store_be32(result + 4 * j, h[j]);
+}
+
+
+size_t
+srecord::digest_sha256::get_size()
+    const
+{
+    return (sha224 ? 28 : 32);
+}
+
+
+const char *
+srecord::digest_sha256::get_name()
+    const
+{
+    return (sha224 ? "SHA224" : "SHA256");
+}
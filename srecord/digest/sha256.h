@@ -0,0 +1,116 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_DIGEST_SHA256_H
+#define SRECORD_DIGEST_SHA256_H
+
+#include <srecord/digest.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::digest_sha256 class is used to represent the calculation
+  * of a SHA-256 or SHA-224 message digest, as described in FIPS 180-4.
+  * It uses the x86 SHA extensions, if the CPU has them.
+  */
+class digest_sha256:
+    public digest
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~digest_sha256() override = default;
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      */
+    static pointer create();
+
+    /**
+      * The create_sha224 class method is used to create new dynamically
+      * allocated instances of this class, which calculate SHA-224
+      * instead.  SHA-224 is SHA-256 with different initial values, and
+      * the result cut short.
+      */
+    static pointer create_sha224();
+
+    // See base class for documentation.
+    void nextbuf(const void *data, size_t nbytes) override;
+
+    // See base class for documentation.
+    void get(uint8_t *result) const override;
+
+    // See base class for documentation.
+    size_t get_size() const override;
+
+    // See base class for documentation.
+    const char *get_name() const override;
+
+private:
+    /**
+      * The constructor.  It is private on purpose, use the #create or
+      * #create_sha224 class methods instead.
+      *
+      * @param sha224
+      *     true for SHA-224, false for SHA-256.
+      */
+    digest_sha256(bool sha224);
+
+    /**
+      * The sha224 instance variable is used to remember whether this
+      * is a SHA-224 calculation, rather than SHA-256.
+      */
+    bool sha224;
+
+    /**
+      * The state instance variable is used to remember the eight words
+      * of the running hash.
+      */
+    uint32_t state[8];
+
+    /**
+      * The length instance variable is used to remember the number of
+      * bytes digested so far.
+      */
+    uint64_t length{0};
+
+    /**
+      * The buffer instance variable is used to remember the bytes of a
+      * partial block, until the rest of the block arrives.
+      */
+    uint8_t buffer[64]{};
+
+public:
+    /**
+      * The copy constructor.  Do not use.
+      */
+    digest_sha256(const digest_sha256 &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    digest_sha256 &operator=(const digest_sha256 &) = delete;
+};
+
+};
+
+#endif // SRECORD_DIGEST_SHA256_H
@@ -0,0 +1,292 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+
+#include <srecord/digest/sha512.h>
+
+
+//
+// The round constants, the first 64 bits of the fractional parts of
+// the cube roots of the first 80 primes.
+//
+static const uint64_t K[80] =
+{
+    0x428A2F98D728AE22, 0x7137449123EF65CD,
+    0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC,
+    0x3956C25BF348B538, 0x59F111F1B605D019,
+    0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118,
+    0xD807AA98A3030242, 0x12835B0145706FBE,
+    0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2,
+    0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1,
+    0x9BDC06A725C71235, 0xC19BF174CF692694,
+    0xE49B69C19EF14AD2, 0xEFBE4786384F25E3,
+    0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65,
+    0x2DE92C6F592B0275, 0x4A7484AA6EA6E483,
+    0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5,
+    0x983E5152EE66DFAB, 0xA831C66D2DB43210,
+    0xB00327C898FB213F, 0xBF597FC7BEEF0EE4,
+    0xC6E00BF33DA88FC2, 0xD5A79147930AA725,
+    0x06CA6351E003826F, 0x142929670A0E6E70,
+    0x27B70A8546D22FFC, 0x2E1B21385C26C926,
+    0x4D2C6DFC5AC42AED, 0x53380D139D95B3DF,
+    0x650A73548BAF63DE, 0x766A0ABB3C77B2A8,
+    0x81C2C92E47EDAEE6, 0x92722C851482353B,
+    0xA2BFE8A14CF10364, 0xA81A664BBC423001,
+    0xC24B8B70D0F89791, 0xC76C51A30654BE30,
+    0xD192E819D6EF5218, 0xD69906245565A910,
+    0xF40E35855771202A, 0x106AA07032BBD1B8,
+    0x19A4C116B8D2D0C8, 0x1E376C085141AB53,
+    0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8,
+    0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB,
+    0x5B9CCA4F7763E373, 0x682E6FF3D6B2B8A3,
+    0x748F82EE5DEFB2FC, 0x78A5636F43172F60,
+    0x84C87814A1F0AB72, 0x8CC702081A6439EC,
+    0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9,
+    0xBEF9A3F7B2C67915, 0xC67178F2E372532B,
+    0xCA273ECEEA26619C, 0xD186B8C721C0C207,
+    0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178,
+    0x06F067AA72176FBA, 0x0A637DC5A2C898A6,
+    0x113F9804BEF90DAE, 0x1B710B35131C471B,
+    0x28DB77F523047D84, 0x32CAAB7B40C72493,
+    0x3C9EBE0A15C9BEBC, 0x431D67C49C100D4C,
+    0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A,
+    0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817,
+};
+
+
+//
+// The initial hash values for SHA-512 and SHA-384.
+//
+static const uint64_t sha512_initial[8] =
+{
+    0x6A09E667F3BCC908, 0xBB67AE8584CAA73B,
+    0x3C6EF372FE94F82B, 0xA54FF53A5F1D36F1,
+    0x510E527FADE682D1, 0x9B05688C2B3E6C1F,
+    0x1F83D9ABFB41BD6B, 0x5BE0CD19137E2179,
+};
+
+static const uint64_t sha384_initial[8] =
+{
+    0xCBBB9D5DC1059ED8, 0x629A292A367CD507,
+    0x9159015A3070DD17, 0x152FECD8F70E5939,
+    0x67332667FFC00B31, 0x8EB44A8768581511,
+    0xDB0C2E0D64F98FA7, 0x47B5481DBEFA4FA4,
+};
+
+
+static inline uint64_t
+load_be64(const uint8_t *p)
+{
+    uint64_t x = 0;
+    for (int j = 0; j < 8; ++j)
+        x = (x << 8) | p[j];
+    return x;
+}
+
+
+static inline void
+store_be64(uint8_t *p, uint64_t x)
+{
+    for (int j = 7; j >= 0; --j)
+    {
+        p[j] = x;
+        x >>= 8;
+    }
+}
+
+
+static inline uint64_t
+ror(uint64_t x, int n)
+{
+    return ((x >> n) | (x << (64 - n)));
+}
+
+
+/**
+  * The sha512_blocks function is used to digest whole 128 byte blocks,
+  * the way FIPS 180-4 describes it.
+  */
+static void
+sha512_blocks(uint64_t *state, const uint8_t *dp, size_t nblocks)
+{
+    for (; nblocks > 0; --nblocks, dp += 128)
+    {
+        uint64_t w[80];
+        for (int t = 0; t < 16; ++t)
+            w[t] = load_be64(dp + 8 * t);
+        for (int t = 16; t < 80; ++t)
+        {
+            uint64_t s0 =
+                ror(w[t - 15], 1) ^ ror(w[t - 15], 8) ^ (w[t - 15] >> 7);
+            uint64_t s1 =
+                ror(w[t - 2], 19) ^ ror(w[t - 2], 61) ^ (w[t - 2] >> 6);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+
+        uint64_t a = state[0];
+        uint64_t b = state[1];
+        uint64_t c = state[2];
+        uint64_t d = state[3];
+        uint64_t e = state[4];
+        uint64_t f = state[5];
+        uint64_t g = state[6];
+        uint64_t h = state[7];
+        for (int t = 0; t < 80; ++t)
+        {
+            uint64_t t1 =
+                h
+            +
+                (ror(e, 14) ^ ror(e, 18) ^ ror(e, 41))
+            +
+                ((e & f) ^ (~e & g))
+            +
+                K[t]
+            +
+                w[t];
+            uint64_t t2 =
+                (ror(a, 28) ^ ror(a, 34) ^ ror(a, 39))
+            +
+                ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+
+srecord::digest_sha512::digest_sha512(bool a_sha384) :
+    sha384(a_sha384)
+{
+    memcpy
+    (
+        state,
+        (sha384 ? sha384_initial : sha512_initial),
+        sizeof(state)
+    );
+}
+
+
+srecord::digest::pointer
+srecord::digest_sha512::create()
+{
+    return pointer(new digest_sha512(false));
+}
+
+
+srecord::digest::pointer
+srecord::digest_sha512::create_sha384()
+{
+    return pointer(new digest_sha512(true));
+}
+void
+srecord::digest_sha512::nextbuf(const void *data, size_t nbytes)
+{
+    const auto *dp = (const uint8_t *)data;
+    size_t used = length % sizeof(buffer);
+    length += nbytes;
+
+    //
+    // Finish off any block left over from last time.
+    //
+    if (used > 0)
+    {
+        size_t n = sizeof(buffer) - used;
+        if (n > nbytes)
+            n = nbytes;
+        memcpy(buffer + used, dp, n);
+        dp += n;
+        nbytes -= n;
+        if (used + n < sizeof(buffer))
+            return;
+        sha512_blocks(state, buffer, 1);
+    }
+
+    //
+    // Then as many whole blocks as there are, straight from the
+    // caller's buffer.
+    //
+    size_t nblocks = nbytes / sizeof(buffer);
+    if (nblocks > 0)
+    {
+        sha512_blocks(state, dp, nblocks);
+        dp += nblocks * sizeof(buffer);
+        nbytes -= nblocks * sizeof(buffer);
+    }
+
+    //
+    // Keep the rest for next time.
+    //
+    memcpy(buffer, dp, nbytes);
+}
+
+
+void
+srecord::digest_sha512::get(uint8_t *result)
+    const
+{
+    //
+    // Pad a copy of the partial block with a one bit, zeros, and the
+    // length in bits, to make one or two more blocks.
+    //
+    uint64_t h[8];
+    memcpy(h, state, sizeof(h));
+    size_t used = length % sizeof(buffer);
+    uint8_t tail[2 * sizeof(buffer)]{};
+    memcpy(tail, buffer, used);
+    tail[used] = 0x80;
+    size_t tail_size = (used < 112 ? 128 : 256);
+    store_be64(tail + tail_size - 16, length >> 61);
+    store_be64(tail + tail_size - 8, length << 3);
+    sha512_blocks(h, tail, tail_size / 128);
+
+    size_t nwords = get_size() / 8;
+    for (size_t j = 0; j < nwords; ++j)
+        store_be64(result + 8 * j, h[j]);
+}
+
+
+size_t
+srecord::digest_sha512::get_size()
+    const
+{
+    return (sha384 ? 48 : 64);
+}
+
+
+const char *
+srecord::digest_sha512::get_name()
+    const
+{
+    return (sha384 ? "SHA384" : "SHA512");
+}
@@ -0,0 +1,115 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_DIGEST_SHA512_H
+#define SRECORD_DIGEST_SHA512_H
+
+#include <srecord/digest.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::digest_sha512 class is used to represent the calculation
+  * of a SHA-512 or SHA-384 message digest, as described in FIPS 180-4.
+  */
+class digest_sha512:
+    public digest
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~digest_sha512() override = default;
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      */
+    static pointer create();
+
+    /**
+      * The create_sha384 class method is used to create new dynamically
+      * allocated instances of this class, which calculate SHA-384
+      * instead.  SHA-384 is SHA-512 with different initial values, and
+      * the result cut short.
+      */
+    static pointer create_sha384();
+
+    // See base class for documentation.
+    void nextbuf(const void *data, size_t nbytes) override;
+
+    // See base class for documentation.
+    void get(uint8_t *result) const override;
+
+    // See base class for documentation.
+    size_t get_size() const override;
+
+    // See base class for documentation.
+    const char *get_name() const override;
+
+private:
+    /**
+      * The constructor.  It is private on purpose, use the #create or
+      * #create_sha384 class methods instead.
+      *
+      * @param sha384
+      *     true for SHA-384, false for SHA-512.
+      */
+    digest_sha512(bool sha384);
+
+    /**
+      * The sha384 instance variable is used to remember whether this
+      * is a SHA-384 calculation, rather than SHA-512.
+      */
+    bool sha384;
+
+    /**
+      * The state instance variable is used to remember the eight words
+      * of the running hash.
+      */
+    uint64_t state[8];
+
+    /**
+      * The length instance variable is used to remember the number of
+      * bytes digested so far.
+      */
+    uint64_t length{0};
+
+    /**
+      * The buffer instance variable is used to remember the bytes of a
+      * partial block, until the rest of the block arrives.
+      */
+    uint8_t buffer[128]{};
+
+public:
+    /**
+      * The copy constructor.  Do not use.
+      */
+    digest_sha512(const digest_sha512 &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    digest_sha512 &operator=(const digest_sha512 &) = delete;
+};
+
+};
+
+#endif // SRECORD_DIGEST_SHA512_H
@@ -18,6 +18,7 @@
 
 #include <cassert>
 
+#include <srecord/byte_sums.h>
 #include <srecord/fletcher16.h>
 
 //
@@ -62,6 +63,17 @@ srecord::fletcher16::next(uint8_t ch)
 }
 
 
+/**
+  * The reduce8 function is used to reduce a sum modulo 255, the way
+  * repeated end-around carry (x & 0xFF) + (x >> 8) would.
+  */
+static inline uint16_t
+reduce8(uint64_t x)
+{
+    return (x == 0 ? 0 : 1 + (x - 1) % 255);
+}
+
+
 void
 srecord::fletcher16::nextbuf(const void *vdata, size_t nbytes)
 {
@@ -82,32 +94,48 @@ srecord::fletcher16::nextbuf(const void *vdata, size_t nbytes)
     //   second repetition guarantees a fully reduced sum in the range of
     //   1..255.
     //
-    // * This uses a 16-bit accumulator to perform a number of sums
-    //   before doing any modular reduction. The magic value 21 is the
-    //   largest number of sums that can be performed without numeric
-    //   overflow in 16 bits. Any smaller value is also permissible; 16
-    //   may be convenient in many cases.
+    // * The sums are accumulated a block at a time, with the reduction
+    //   deferred to the end of each block (see byte_sums.h), and done
+    //   with a modulo that gives the same answer as repeated end-around
+    //   carries: zero stays zero, and any other multiple of 255 becomes
+    //   255.
     //
     const auto *data = (const uint8_t *)vdata;
-    size_t len = nbytes;
-    while (len)
+    while (nbytes > 0)
     {
-        size_t tlen = len > 21 ? 21 : len;
-        len -= tlen;
-        for (;;)
-        {
-            sum1 += *data++;
-            sum2 += sum1;
-            --tlen;
-            if (!tlen)
-                break;
-        }
-        sum1 = (sum1 & 0xFF) + (sum1 >> 8);
-        sum2 = (sum2 & 0xFF) + (sum2 >> 8);
+        size_t n = (nbytes < byte_sums_max ? nbytes : byte_sums_max);
+        uint32_t sum;
+        uint32_t weighted;
+        byte_sums(data, n, sum, weighted);
+        uint64_t b = sum2 + (uint64_t)n * sum1 + weighted;
+        sum1 = reduce8(sum1 + (uint64_t)sum);
+        sum2 = reduce8(b);
+        data += n;
+        nbytes -= n;
     }
-    // Second reduction step to reduce sums to 8 bits
-    sum1 = (sum1 & 0xFF) + (sum1 >> 8);
-    sum2 = (sum2 & 0xFF) + (sum2 >> 8);
+}
+
+
+void
+srecord::fletcher16::clear()
+{
+    sum1 = 0;
+    sum2 = 0;
+}
+
+
+void
+srecord::fletcher16::combine(const fletcher16 &later, size_t nbytes)
+{
+    //
+    // The later sum2 counts each of its bytes once too few times for
+    // every byte seen before, which sum1 times nbytes makes up.  The
+    // sums are all positive, so the total is only zero if each part
+    // is, and reduce8 gives the same answer as the serial code.
+    //
+    uint64_t b = sum2 + (uint64_t)nbytes * sum1 + later.sum2;
+    sum1 = reduce8(sum1 + (uint64_t)later.sum1);
+    sum2 = reduce8(b);
 }
 
 
@@ -100,6 +100,25 @@ class fletcher16
       */
     void nextbuf(const void *data, size_t data_size);
 
+    /**
+      * The clear method is used to zero the running state, rather than
+      * seed it, so that this instance can work out a slice of the data
+      * for the #combine method.
+      */
+    void clear();
+
+    /**
+      * The combine method is used to advance the state as if the bytes
+      * of a later slice had been passed to #nextbuf.
+      *
+      * @param later
+      *     The checksum of the bytes immediately following those seen
+      *     so far, started with the #clear method.
+      * @param nbytes
+      *     The number of bytes seen by later.
+      */
+    void combine(const fletcher16 &later, size_t nbytes);
+
 private:
     /**
       * The sum1 instance variable is used to remember the running sum
@@ -16,6 +16,7 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <srecord/byte_sums.h>
 #include <srecord/fletcher32.h>
 
 
@@ -42,6 +43,17 @@ srecord::fletcher32::next(uint8_t x)
 }
 
 
+/**
+  * The reduce16 function is used to reduce a sum modulo 65535, the way
+  * repeated end-around carry (x & 0xFFFF) + (x >> 16) would.
+  */
+static inline uint32_t
+reduce16(uint64_t x)
+{
+    return (x == 0 ? 0 : 1 + (x - 1) % 65535);
+}
+
+
 void
 srecord::fletcher32::nextbuf(const void *vdata, size_t nbytes)
 {
@@ -62,32 +74,48 @@ srecord::fletcher32::nextbuf(const void *vdata, size_t nbytes)
     // 0x1FFFE.  A second repetition guarantees a fully reduced sum in
     // the range of 1..65535.
     //
-    // * This uses a 32-bit accumulator to perform a number of sums
-    // before doing any modular reduction.  The magic value 360 is the
-    // largest number of sums that can be performed without numeric
-    // overflow.  Any smaller value is also permissible; 256 may be
-    // convenient in many cases.
+    // * The sums are accumulated a block at a time, with the reduction
+    //   deferred to the end of each block (see byte_sums.h), and done
+    //   with a modulo that gives the same answer as repeated end-around
+    //   carries: zero stays zero, and any other multiple of 65535 becomes
+    //   65535.
     //
     const auto *data = (const uint8_t *)vdata;
-    size_t len = nbytes;
-    while (len)
+    while (nbytes > 0)
     {
-        unsigned tlen = len > 360 ? 360 : len;
-        len -= tlen;
-        for (;;)
-        {
-            sum1 += *data++;
-            sum2 += sum1;
-            --tlen;
-            if (!tlen)
-                break;
-        }
-        sum1 = (sum1 & 0xFFFF) + (sum1 >> 16);
-        sum2 = (sum2 & 0xFFFF) + (sum2 >> 16);
+        size_t n = (nbytes < byte_sums_max ? nbytes : byte_sums_max);
+        uint32_t sum;
+        uint32_t weighted;
+        byte_sums(data, n, sum, weighted);
+        uint64_t b = sum2 + (uint64_t)n * sum1 + weighted;
+        sum1 = reduce16(sum1 + (uint64_t)sum);
+        sum2 = reduce16(b);
+        data += n;
+        nbytes -= n;
     }
-    // Second reduction step to reduce sums to 16 bits
-    sum1 = (sum1 & 0xFFFF) + (sum1 >> 16);
-    sum2 = (sum2 & 0xFFFF) + (sum2 >> 16);
+}
+
+
+void
+srecord::fletcher32::clear()
+{
+    sum1 = 0;
+    sum2 = 0;
+}
+
+
+void
+srecord::fletcher32::combine(const fletcher32 &later, size_t nbytes)
+{
+    //
+    // The later sum2 counts each of its bytes once too few times for
+    // every byte seen before, which sum1 times nbytes makes up.  The
+    // sums are all positive, so the total is only zero if each part
+    // is, and reduce16 gives the same answer as the serial code.
+    //
+    uint64_t b = sum2 + (uint64_t)nbytes * sum1 + later.sum2;
+    sum1 = reduce16(sum1 + (uint64_t)later.sum1);
+    sum2 = reduce16(b);
 }
 
 
@@ -94,3 +94,17 @@ srecord::input::command_line(srecord::arglex_tool *)
 {
     // Do nothing.
 }
+
+
+bool
+srecord::input::defer_fill()
+{
+    return false;
+}
+
+
+bool
+srecord::input::get_deferred_fill(interval &, int &)
+{
+    return false;
+}
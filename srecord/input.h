@@ -28,6 +28,7 @@
 namespace srecord {
 
 class arglex_tool; // forward
+class interval; // forward
 class quit; // forward
 
 /**
@@ -152,6 +153,34 @@ class input
       */
     virtual void command_line(srecord::arglex_tool *cmdln);
 
+    /**
+      * The defer_fill method is used by srecord::memory::reader to ask
+      * this input not to generate the constant fill it would otherwise
+      * return as data records once its data is exhausted, so that the
+      * fill can be written straight into memory instead.  See
+      * #get_deferred_fill.  The default implementation returns false:
+      * there is no fill to defer.
+      *
+      * @returns
+      *     true if the fill will be deferred, false if not.
+      */
+    virtual bool defer_fill();
+
+    /**
+      * The get_deferred_fill method is used to obtain the fill held back
+      * after a successful call to #defer_fill.  Only meaningful once
+      * #read has returned false.  The default implementation returns
+      * false.
+      *
+      * @param range
+      *     Where to return the addresses to be filled.
+      * @param value
+      *     Where to return the byte value to fill with.
+      * @returns
+      *     true if there is a fill, false if not.
+      */
+    virtual bool get_deferred_fill(interval &range, int &value);
+
 private:
     /**
       * The quitter instance variable is used to remember how to quit.
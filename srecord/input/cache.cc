@@ -0,0 +1,172 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cassert>
+
+#include <srecord/input/cache.h>
+#include <srecord/record.h>
+
+
+srecord::input_cache::input_cache(const store_pointer &a_sp) :
+    sp(a_sp)
+{
+    assert(sp->shareable());
+    ++sp->readers;
+}
+
+
+srecord::input::pointer
+srecord::input_cache::create(const input::pointer &a_source)
+{
+    store_pointer sp = std::make_shared<store>();
+    sp->source = a_source;
+    return create(sp);
+}
+
+
+srecord::input::pointer
+srecord::input_cache::create(const store_pointer &a_sp)
+{
+    return pointer(new input_cache(a_sp));
+}
+
+
+bool
+srecord::input_cache::get_range(interval &range)
+    const
+{
+    if (!sp->keeping || !sp->complete)
+        return false;
+    range = sp->range;
+    return true;
+}
+
+
+bool
+srecord::input_cache::read(srecord::record &record)
+{
+    store &st = *sp;
+    if (!st.started)
+    {
+        st.started = true;
+        st.keeping = (st.readers > 1);
+    }
+    if (!st.keeping)
+        return st.source->read(record);
+
+    //
+    // Replay the records somebody else has already parsed.
+    //
+    if (position < st.entries.size())
+    {
+        const store::entry &e = st.entries[position++];
+        record =
+            srecord::record
+            (
+                e.type,
+                e.address,
+                st.data.data() + e.data_offset,
+                e.length
+            );
+        replaying = true;
+        return true;
+    }
+    replaying = false;
+    if (st.complete)
+        return false;
+
+    //
+    // We are the first to get this far; parse another record, and
+    // keep it for the others.
+    //
+    if (!st.source->read(record))
+    {
+        st.complete = true;
+        return false;
+    }
+    std::string fn = st.source->filename();
+    std::string fal = st.source->filename_and_line();
+    if (fal.compare(0, fn.size(), fn) == 0)
+        fal.erase(0, fn.size());
+    else
+        fal.clear();
+    store::entry e =
+    {
+        record.get_type(),
+        record.get_address(),
+        record.get_length(),
+        st.data.size(),
+        st.where.size()
+    };
+    st.entries.push_back(e);
+    st.data.insert
+    (
+        st.data.end(),
+        record.get_data(),
+        record.get_data() + record.get_length()
+    );
+    st.where += fal;
+    st.where += '\0';
+    if (record.get_type() == srecord::record::type_data)
+    {
+        st.range +=
+            interval
+            (
+                record.get_address(),
+                record.get_address() + record.get_length()
+            );
+    }
+    ++position;
+    replaying = true;
+    return true;
+}
+
+
+std::string
+srecord::input_cache::filename()
+    const
+{
+    return sp->source->filename();
+}
+
+
+std::string
+srecord::input_cache::filename_and_line()
+    const
+{
+    if (!replaying || position == 0)
+        return sp->source->filename_and_line();
+    const store::entry &e = sp->entries[position - 1];
+    return (filename() + (sp->where.c_str() + e.where_offset));
+}
+
+
+const char *
+srecord::input_cache::get_file_format_name()
+    const
+{
+    return sp->source->get_file_format_name();
+}
+
+
+void
+srecord::input_cache::disable_checksum_validation()
+{
+    sp->source->disable_checksum_validation();
+}
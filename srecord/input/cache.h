@@ -0,0 +1,236 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_INPUT_CACHE_H
+#define SRECORD_INPUT_CACHE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <srecord/input.h>
+#include <srecord/interval.h>
+#include <srecord/record.h>
+
+namespace srecord {
+
+/**
+  * The srecord::input_cache class is used to represent an input file
+  * which is named more than once on the command line, for example as
+  * the main input and again as the argument of -over or -maximum-address.
+  * The file is parsed once; the records are kept in a shared store and
+  * replayed to every other reader, along with the address range of the
+  * data records.
+  */
+class input_cache:
+    public input
+{
+public:
+    /**
+      * The store class is used to remember the records of one input
+      * file, shared between all of the input_cache instances reading it.
+      */
+    struct store
+    {
+        /**
+          * The entry struct is used to remember the position of one
+          * record in the store.
+          */
+        struct entry
+        {
+            record::type_t type;
+            record::address_t address;
+            size_t length;
+            size_t data_offset;
+            size_t where_offset;
+        };
+
+        /**
+          * The source instance variable is used to remember the input
+          * file being parsed.
+          */
+        input::pointer source;
+
+        /**
+          * The entries instance variable is used to remember the records
+          * read from the source so far, in order.
+          */
+        std::vector<entry> entries;
+
+        /**
+          * The data instance variable is used to remember the payloads
+          * of the entries, packed end to end.
+          */
+        std::vector<record::data_t> data;
+
+        /**
+          * The where instance variable is used to remember the source
+          * location of each entry, as the part of filename_and_line
+          * after the file name, each terminated by a NUL.
+          */
+        std::string where;
+
+        /**
+          * The range instance variable is used to remember the address
+          * range of the data records read so far.
+          */
+        interval range;
+
+        /**
+          * The readers instance variable is used to remember how many
+          * input_cache instances have been created for this store.
+          */
+        size_t readers{0};
+
+        /**
+          * The started instance variable is used to remember whether
+          * any records have been read from the source.
+          */
+        bool started{false};
+
+        /**
+          * The keeping instance variable is used to remember whether
+          * the records are being kept.  This is decided by the first
+          * read: if there is only one reader, there is nothing to share
+          * and the records are passed straight through.
+          */
+        bool keeping{false};
+
+        /**
+          * The complete instance variable is used to remember whether
+          * the source has been read to the end.
+          */
+        bool complete{false};
+
+        /**
+          * The shareable method is used to determine whether another
+          * reader may be attached to this store.  Once records have
+          * been passed through without being kept, they are gone.
+          */
+        bool shareable() const { return !started || keeping; }
+    };
+
+    typedef std::shared_ptr<store> store_pointer;
+
+    /**
+      * The destructor.
+      */
+    ~input_cache() override = default;
+
+private:
+    /**
+      * The constructor.
+      * It is private on purpose, use the #create class method instead.
+      *
+      * @param sp
+      *     The store to read from.
+      */
+    input_cache(const store_pointer &sp);
+
+public:
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class, reading a new store.
+      *
+      * @param source
+      *     The input file to be parsed.
+      */
+    static pointer create(const input::pointer &source);
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class, sharing an existing store.
+      *
+      * @param sp
+      *     The store to read from.  It must be shareable.
+      */
+    static pointer create(const store_pointer &sp);
+
+    /**
+      * The get_store method is used to obtain the store this input is
+      * reading from, so that other readers may share it.
+      */
+    const store_pointer &get_store() const { return sp; }
+
+    /**
+      * The get_range method is used to obtain the address range of the
+      * data records of the whole file, without replaying them, if the
+      * file has already been read to the end.
+      *
+      * @param range
+      *     Where to return the address range.
+      * @returns
+      *     true if the range is known, false if the records must be read
+      */
+    bool get_range(interval &range) const;
+
+protected:
+    // See base class for documentation.
+    bool read(record &record) override;
+
+    // See base class for documentation.
+    std::string filename() const override;
+
+    // See base class for documentation.
+    std::string filename_and_line() const override;
+
+    // See base class for documentation.
+    const char *get_file_format_name() const override;
+
+    // See base class for documentation.
+    void disable_checksum_validation() override;
+
+private:
+    /**
+      * The sp instance variable is used to remember the shared store.
+      */
+    store_pointer sp;
+
+    /**
+      * The position instance variable is used to remember the index of
+      * the next entry to be replayed.
+      */
+    size_t position{0};
+
+    /**
+      * The replaying instance variable is used to remember whether the
+      * last record came from the store, rather than from the source.
+      */
+    bool replaying{false};
+
+public:
+    /**
+      * The default constructor.
+      */
+    input_cache() = delete;
+
+    /**
+      * The copy constructor.
+      */
+    input_cache(const input_cache &) = delete;
+
+    /**
+      * The assignment operator.
+      */
+    input_cache &operator=(const input_cache &) = delete;
+};
+
+};
+
+#endif // SRECORD_INPUT_CACHE_H
@@ -17,36 +17,58 @@
 //
 
 #include <cassert>
+#include <memory>
 
 #include <srecord/input/catenate.h>
 #include <srecord/record.h>
 
-srecord::input_catenate::input_catenate(const pointer &a1, const pointer &a2) :
-    in1(a1),
-    in2(a2)
+srecord::input_catenate::input_catenate(const std::vector<pointer> &a_inputs)
 {
-    assert(!!in1);
-    assert(!!in2);
+    assert(!a_inputs.empty());
+    for (const pointer &ip : a_inputs)
+    {
+        assert(!!ip);
+        auto cp = std::dynamic_pointer_cast<input_catenate>(ip);
+        if (cp && cp->current == 0)
+        {
+            inputs.insert(inputs.end(), cp->inputs.begin(), cp->inputs.end());
+        }
+        else
+            inputs.push_back(ip);
+    }
 }
 
 
 srecord::input::pointer
 srecord::input_catenate::create(const pointer &a1, const pointer &a2)
 {
-    return pointer(new srecord::input_catenate(a1, a2));
+    return create(std::vector<pointer>{ a1, a2 });
+}
+
+
+srecord::input::pointer
+srecord::input_catenate::create(const std::vector<pointer> &a_inputs)
+{
+    return pointer(new srecord::input_catenate(a_inputs));
 }
 
 
 bool
 srecord::input_catenate::read(srecord::record &record)
 {
-    while (in1)
+    while (current < inputs.size())
     {
-        bool ok = in1->read(record);
+        bool ok = inputs[current]->read(record);
         if (!ok)
         {
-            in1.reset();
-            break;
+            //
+            // Keep the last input, so that there is still a file name
+            // to report.
+            //
+            if (current + 1 < inputs.size())
+                inputs[current].reset();
+            ++current;
+            continue;
         }
         switch (record.get_type())
         {
@@ -58,21 +80,15 @@ srecord::input_catenate::read(srecord::record &record)
             return true;
         }
     }
-    for (;;)
-    {
-        bool ok = in2->read(record);
-        if (!ok)
-            return false;
-        switch (record.get_type())
-        {
-        case srecord::record::type_unknown:
-        case srecord::record::type_data_count:
-            break;
+    return false;
+}
 
-        default:
-            return true;
-        }
-    }
+
+const srecord::input::pointer &
+srecord::input_catenate::get_current()
+    const
+{
+    return inputs[current < inputs.size() ? current : inputs.size() - 1];
 }
 
 
@@ -80,7 +96,7 @@ std::string
 srecord::input_catenate::filename()
     const
 {
-    return (in1 ? in1 : in2)->filename();
+    return get_current()->filename();
 }
 
 
@@ -88,7 +104,7 @@ std::string
 srecord::input_catenate::filename_and_line()
     const
 {
-    return (in1 ? in1 : in2)->filename_and_line();
+    return get_current()->filename_and_line();
 }
 
 
@@ -96,14 +112,13 @@ const char *
 srecord::input_catenate::get_file_format_name()
     const
 {
-    return (in1 ? in1 : in2)->get_file_format_name();
+    return get_current()->get_file_format_name();
 }
 
 
 void
 srecord::input_catenate::disable_checksum_validation()
 {
-    if (in1)
-        in1->disable_checksum_validation();
-    in2->disable_checksum_validation();
+    for (size_t j = current; j < inputs.size(); ++j)
+        inputs[j]->disable_checksum_validation();
 }
@@ -19,14 +19,19 @@
 #ifndef SRECORD_INPUT_CATENATE_H
 #define SRECORD_INPUT_CATENATE_H
 
+#include <vector>
+
 #include <srecord/input.h>
 
 namespace srecord {
 
 /**
   * The srecord::input_catenate class is used to represent an input source
-  * which presents two input sources as if they were a single input
-  * source.
+  * which presents several input sources, one after the other, as if
+  * they were a single input source.
+  *
+  * The inputs are held in one flat list, so reading a record costs one
+  * extra virtual call no matter how many files are on the command line.
   */
 class input_catenate:
     public input
@@ -42,12 +47,10 @@ class input_catenate:
       * The constructor.
       * It is private on purpose, use the #create class method instead.
       *
-      * @param in1
-      *     The first of the inputs to be read.
-      * @param in2
-      *     The second of the inputs to be read.
+      * @param inputs
+      *     The inputs to be read, in order.
       */
-    input_catenate(const pointer &in1, const pointer &in2);
+    input_catenate(const std::vector<pointer> &inputs);
 
 public:
     /**
@@ -61,6 +64,18 @@ class input_catenate:
       */
     static pointer create(const pointer &in1, const pointer &in2);
 
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      *
+      * Any of the inputs which are themselves (unread) catenations are
+      * flattened into the new list.
+      *
+      * @param inputs
+      *     The inputs to be read, in order.  There must be at least one.
+      */
+    static pointer create(const std::vector<pointer> &inputs);
+
 protected:
     // See base class for documentation.
     bool read(record &record) override;
@@ -79,16 +94,23 @@ class input_catenate:
 
 private:
     /**
-      * The in1 instance variable is used to remember the first of the
-      * inputs to be read.
+      * The inputs instance variable is used to remember the inputs to
+      * be read, in order.
+      */
+    std::vector<pointer> inputs;
+
+    /**
+      * The current instance variable is used to remember the index of
+      * the input presently being read.  The inputs before it have all
+      * been exhausted.
       */
-    pointer in1;
+    size_t current{0};
 
     /**
-      * The in2 instance variable is used to remember the second of the
-      * inputs to be read.
+      * The get_current method is used to obtain the input presently
+      * being read, or the last input once they have all been exhausted.
       */
-    pointer in2;
+    const pointer &get_current() const;
 
 public:
     /**
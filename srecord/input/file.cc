@@ -17,6 +17,7 @@
 // <http://www.gnu.org/licenses/>.
 //
 
+#include <cassert>
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
@@ -167,6 +168,20 @@ srecord::input_file::get_char_undo(int c)
 }
 
 
+size_t
+srecord::input_file::get_bytes(uint8_t *data, size_t nbytes)
+{
+    assert(is_binary());
+    FILE *fp = (FILE *)get_fp();
+    size_t n = fread(data, 1, nbytes, fp);
+    if (n < nbytes && ferror(fp))
+        fatal_error_errno("read");
+    line_number += n;
+    prev_was_newline = false;
+    return n;
+}
+
+
 int
 srecord::input_file::peek_char()
 {
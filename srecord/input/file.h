@@ -19,6 +19,8 @@
 #ifndef SRECORD_INPUT_FILE_H
 #define SRECORD_INPUT_FILE_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include <srecord/input.h>
@@ -107,6 +109,21 @@ class input_file:
       */
     virtual void get_char_undo(int);
 
+    /**
+      * The get_bytes method is used to fetch a block of bytes from a
+      * binary input, in one call rather than one get_char call per
+      * byte.  The line_number instance variable is maintained, as for
+      * get_char.
+      *
+      * @param data
+      *     Where to put the bytes.
+      * @param nbytes
+      *     The most bytes to fetch.
+      * @returns
+      *     the number of bytes fetched; zero at end of file
+      */
+    size_t get_bytes(uint8_t *data, size_t nbytes);
+
     /**
       * The peek_char method is used to look at the next character
       * of input, without actually consuming it (a later get_char
@@ -51,20 +51,10 @@ srecord::input_file_binary::read(srecord::record &record)
     //
 #endif
 
-    int c = get_char();
-    if (c < 0)
-        return false;
-    int length = 0;
     uint8_t data[srecord::record::max_data_length];
-    for (;;)
-    {
-        data[length++] = c;
-        if (length >= (int)sizeof(data))
-            break;
-        c = get_char();
-        if (c < 0)
-            break;
-    }
+    size_t length = get_bytes(data, sizeof(data));
+    if (length == 0)
+        return false;
     record = srecord::record(srecord::record::type_data, address, data, length);
     address += length;
     return true;
@@ -62,3 +62,11 @@ srecord::input_filter::disable_checksum_validation()
 {
     ifp->disable_checksum_validation();
 }
+
+
+bool
+srecord::input_filter::fuse_into(input_filter_fused &)
+    const
+{
+    return false;
+}
@@ -25,6 +25,8 @@
 
 namespace srecord {
 
+class input_filter_fused; // forward
+
 /**
   * The srecord::input_filter class is an abstract interface for all of the
   * various filters that can be applied to an incoming EPROM file.
@@ -56,6 +58,35 @@ class input_filter:
     // See base class for documentation.
     void disable_checksum_validation() override;
 
+    /**
+      * The fuse_into method is used by the filter chain optimiser to
+      * ask this filter to add itself to a fused stage (see
+      * srecord::input_filter_fused for details).  Filters that can not
+      * be fused (the default) return false, and leave the stage alone.
+      *
+      * @param stage
+      *     The fused stage to be extended.
+      * @returns
+      *     true if this filter was added to the stage, false if not.
+      */
+    virtual bool fuse_into(input_filter_fused &stage) const;
+
+    /**
+      * The get_deeper method is used by the filter chain optimiser to
+      * walk down the filter chain.
+      */
+    const pointer &get_deeper() const { return ifp; }
+
+    /**
+      * The set_deeper method is used by the filter chain optimiser to
+      * replace the deeper input once the filters below this one have
+      * been fused.
+      *
+      * @param deeper
+      *     The new deeper input to be filtered.
+      */
+    void set_deeper(const pointer &deeper) { ifp = deeper; }
+
 protected:
     /**
       * The constructor.  Only derived classes may call.
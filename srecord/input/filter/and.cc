@@ -17,7 +17,11 @@
 // <http://www.gnu.org/licenses/>.
 //
 
+#include <cstdio>
+
+#include <srecord/byte_transform.h>
 #include <srecord/input/filter/and.h>
+#include <srecord/input/filter/fused.h>
 #include <srecord/record.h>
 
 
@@ -43,8 +47,22 @@ srecord::input_filter_and::read(record &result)
         return false;
     if (result.get_type() == record::type_data)
     {
-        for (size_t j = 0; j < result.get_length(); ++j)
-            result.set_data(j, result.get_data(j) & value);
+        byte_transform_and(result.get_data(), result.get_length(), value);
     }
     return true;
 }
+
+
+bool
+srecord::input_filter_and::fuse_into(input_filter_fused &stage)
+    const
+{
+    record::data_t table[256];
+    for (unsigned j = 0; j < 256; ++j)
+        table[j] = j;
+    byte_transform_and(table, sizeof(table), value);
+    char name[16];
+    snprintf(name, sizeof(name), "and 0x%02X", value);
+    stage.fuse_map(name, table);
+    return true;
+}
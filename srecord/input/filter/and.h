@@ -61,6 +61,9 @@ class input_filter_and:
       */
     static pointer create(const input::pointer &deeper, int mask);
 
+    // See base class for documentation.
+    bool fuse_into(input_filter_fused &stage) const override;
+
 protected:
     // See base class for documentation.
     bool read(record &record) override;
@@ -16,8 +16,9 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <srecord/bitrev.h>
+#include <srecord/byte_transform.h>
 #include <srecord/input/filter/bitrev.h>
+#include <srecord/input/filter/fused.h>
 #include <srecord/record.h>
 
 
@@ -43,8 +44,20 @@ srecord::input_filter_bitrev::read(srecord::record &record)
         return false;
     if (record.get_type() == srecord::record::type_data)
     {
-        for (size_t j = 0; j < record.get_length(); ++j)
-            record.set_data(j, bitrev8(record.get_data(j)));
+        byte_transform_bitrev(record.get_data(), record.get_length());
     }
     return true;
 }
+
+
+bool
+srecord::input_filter_bitrev::fuse_into(input_filter_fused &stage)
+    const
+{
+    record::data_t table[256];
+    for (unsigned j = 0; j < 256; ++j)
+        table[j] = j;
+    byte_transform_bitrev(table, sizeof(table));
+    stage.fuse_map("bit reverse", table);
+    return true;
+}
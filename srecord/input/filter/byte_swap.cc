@@ -59,9 +59,38 @@ srecord::input_filter_byte_swap::read(srecord::record &record)
             buffer_pos = 0;
         }
 
-        uint32_t addr = (buffer.get_address() + buffer_pos) ^ mask;
-        uint8_t c = buffer.get_data(buffer_pos++);
-        record = srecord::record(srecord::record::type_data, addr, &c, 1);
+        //
+        // A run of whole words maps onto itself, with the bytes of
+        // each word reversed, so it can be passed on as one record.
+        // A partial word at either end of the buffer maps onto a
+        // contiguous part of its own word, so it is a record by itself.
+        //
+        uint32_t addr = buffer.get_address() + buffer_pos;
+        size_t width = mask + 1;
+        size_t phase = addr & mask;
+        size_t nbytes = buffer.get_length() - buffer_pos;
+        const uint8_t *src = buffer.get_data() + buffer_pos;
+        uint8_t data[srecord::record::max_data_length];
+        if (phase != 0 || nbytes < width)
+        {
+            if (nbytes > width - phase)
+                nbytes = width - phase;
+            for (size_t j = 0; j < nbytes; ++j)
+                data[j] = src[nbytes - 1 - j];
+            addr = (addr + nbytes - 1) ^ mask;
+        }
+        else
+        {
+            nbytes -= nbytes % width;
+            for (size_t j = 0; j < nbytes; j += width)
+            {
+                for (size_t k = 0; k < width; ++k)
+                    data[j + k] = src[j + width - 1 - k];
+            }
+        }
+        buffer_pos += nbytes;
+        record =
+            srecord::record(srecord::record::type_data, addr, data, nbytes);
         return true;
     }
 }
@@ -17,6 +17,7 @@
 // <http://www.gnu.org/licenses/>.
 //
 
+#include <srecord/byte_sums.h>
 #include <srecord/interval.h>
 #include <srecord/input/filter/checksum.h>
 #include <srecord/record.h>
@@ -39,10 +40,10 @@ srecord::input_filter_checksum::input_filter_checksum(
         length = 0;
     else if (length > (int)sizeof(sum_t))
         length = sizeof(sum_t);
+    if (width > length)
+        width = length;
     if (width < 1)
         width = 1;
-    else if (width > length)
-        width = length;
 }
 
 
@@ -67,31 +68,21 @@ srecord::input_filter_checksum::read(record &record)
         return generate(record);
     if (record.get_type() == record::type_data)
     {
-        if (width <= 1)
-        {
-            for (size_t j = 0; j < record.get_length(); ++j)
-            {
-                sum += record.get_data(j);
-            }
-        }
-        else if (end == endian_little)
-        {
-            // Little endian
-            for (size_t j = 0; j < record.get_length(); ++j)
-            {
-                sum += (sum_t)record.get_data(j) << (8 *
-                    ((record.get_address() + j) % width));
-            }
-        }
-        else
+        //
+        // Sum the bytes of each lane (address modulo width) first, so
+        // that each lane's sum is shifted into place once, rather than
+        // every byte.  The lanes of the record's first byte start
+        // part way through a word when its address is not aligned.
+        //
+        uint32_t lanes[sizeof(sum_t)];
+        byte_lane_sums(record.get_data(), record.get_length(), width, lanes);
+        unsigned first = record.get_address() % width;
+        for (int k = 0; k < width; ++k)
         {
-            // Big endian
-            for (size_t j = 0; j < record.get_length(); ++j)
-            {
-                sum += (sum_t)record.get_data(j) << (8 *
-                    (width - 1 - ((record.get_address() + j)
-                    % width)));
-            }
+            int lane = (first + k) % width;
+            if (end != endian_little)
+                lane = width - 1 - lane;
+            sum += (sum_t)lanes[k] << (8 * lane);
         }
     }
     return true;
@@ -19,6 +19,7 @@
 
 #include <srecord/interval.h>
 #include <srecord/input/filter/crop.h>
+#include <srecord/input/filter/fused.h>
 #include <srecord/record.h>
 
 
@@ -134,3 +135,12 @@ srecord::input_filter_crop::read(srecord::record &record)
         return true;
     }
 }
+
+
+bool
+srecord::input_filter_crop::fuse_into(input_filter_fused &stage)
+    const
+{
+    stage.fuse_crop(range);
+    return true;
+}
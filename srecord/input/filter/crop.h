@@ -64,6 +64,9 @@ class input_filter_crop:
       */
     static pointer create(const input::pointer &deeper, const interval &range);
 
+    // See base class for documentation.
+    bool fuse_into(input_filter_fused &stage) const override;
+
 protected:
     // See base class for documentation.
     bool read(record &record) override;
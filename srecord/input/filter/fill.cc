@@ -51,26 +51,38 @@ srecord::input_filter_fill::create(const input::pointer &a_deeper,
 bool
 srecord::input_filter_fill::generate(record &result)
 {
-    if (range.empty())
-        return false;
-    interval::data_t lo = range.get_lowest();
-    size_t rec_len = record::maximum_data_length(lo);
-    interval::data_t hi = lo + rec_len;
-    if (hi < lo)
-        hi = 0;
-    interval chunk(lo, hi);
-    chunk *= range;
-    chunk.first_interval_only();
+    if (!generating)
+    {
+        range.get_runs(runs);
+        run_index = 0;
+        remaining = 0;
+        generating = true;
+    }
+    while (remaining == 0)
+    {
+        if (run_index >= runs.size())
+            return false;
+        cursor = runs[run_index];
+        interval::long_data_t hi = runs[run_index + 1];
+        if (hi == 0)
+            hi = (interval::long_data_t)1 << 32;
+        remaining = hi - cursor;
+        run_index += 2;
+    }
+
     size_t fill_block_size = 256;
     if (!filler_block)
     {
         filler_block = new uint8_t [fill_block_size];
         memset(filler_block, filler_value, fill_block_size);
     }
-    rec_len = chunk.get_highest() - chunk.get_lowest();
+    size_t rec_len = record::maximum_data_length(cursor);
+    if (rec_len > remaining)
+        rec_len = remaining;
     assert(rec_len <= fill_block_size);
-    result = record(record::type_data, lo, filler_block, rec_len);
-    range -= chunk;
+    result = record(record::type_data, cursor, filler_block, rec_len);
+    cursor += rec_len;
+    remaining -= rec_len;
     return true;
 }
 
@@ -79,7 +91,7 @@ bool
 srecord::input_filter_fill::read(record &result)
 {
     if (!input_filter::read(result))
-        return generate(result);
+        return (deferred ? false : generate(result));
     if (result.get_type() == record::type_data)
     {
         range -=
@@ -91,3 +103,22 @@ srecord::input_filter_fill::read(record &result)
     }
     return true;
 }
+
+
+bool
+srecord::input_filter_fill::defer_fill()
+{
+    deferred = true;
+    return true;
+}
+
+
+bool
+srecord::input_filter_fill::get_deferred_fill(interval &a_range, int &a_value)
+{
+    if (!deferred)
+        return false;
+    a_range = range;
+    a_value = filler_value;
+    return true;
+}
@@ -20,6 +20,8 @@
 #ifndef SRECORD_INPUT_FILTER_FILL_H
 #define SRECORD_INPUT_FILTER_FILL_H
 
+#include <vector>
+
 #include <srecord/interval.h>
 #include <srecord/input/filter.h>
 #include <srecord/record.h>
@@ -68,6 +70,12 @@ class input_filter_fill:
     static pointer create(const input::pointer &deeper, int value,
         const interval &range);
 
+    // See base class for documentation.
+    bool defer_fill() override;
+
+    // See base class for documentation.
+    bool get_deferred_fill(interval &range, int &value) override;
+
 protected:
     // See base class for documentation.
     bool read(record &record) override;
@@ -88,11 +96,50 @@ class input_filter_fill:
 
     /**
       * The range instance variable is used to remember the range of
-      * addresses to be filled.  As fill blocks are produced the range
-      * is reduced.
+      * addresses to be filled.  As data records are read, their
+      * addresses are removed from the range.
       */
     interval range;
 
+    /**
+      * The deferred instance variable is used to remember whether or
+      * not the fill is to be collected with #get_deferred_fill rather
+      * than generated as records.
+      */
+    bool deferred{false};
+
+    /**
+      * The runs instance variable is used to remember the [lo, hi)
+      * pairs of the range, once the deeper input is exhausted and fill
+      * records are being generated.
+      */
+    std::vector<interval::data_t> runs;
+
+    /**
+      * The run_index instance variable is used to remember the index,
+      * within #runs, of the next run to be filled.
+      */
+    size_t run_index{0};
+
+    /**
+      * The cursor instance variable is used to remember the address of
+      * the next fill record.
+      */
+    interval::data_t cursor{0};
+
+    /**
+      * The remaining instance variable is used to remember how many
+      * bytes of the current run are still to be filled.
+      */
+    interval::long_data_t remaining{0};
+
+    /**
+      * The generating instance variable is used to remember whether or
+      * not the deeper input has been exhausted, and fill generation
+      * has begun.
+      */
+    bool generating{false};
+
     /**
       * The generate method is used to generate fill records.
       */
@@ -0,0 +1,446 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <typeinfo>
+#ifdef __GNUC__
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+#include <srecord/byte_transform.h>
+#include <srecord/input/filter/fused.h>
+
+
+srecord::input_filter_fused::input_filter_fused(
+        const input::pointer &a_deeper) :
+    input_filter(a_deeper)
+{
+    for (unsigned j = 0; j < 256; ++j)
+        table[j] = j;
+}
+
+
+static std::string
+hex(uint32_t x)
+{
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "0x%02X", (unsigned)x);
+    return buffer;
+}
+
+
+/**
+  * The shift function is used to move every address in an interval by
+  * the given amount, modulo 2**32.  Pieces which wrap past the top of
+  * the address space are split in two.
+  */
+static srecord::interval
+shift(const srecord::interval &arg, uint32_t nbytes)
+{
+    if (nbytes == 0)
+        return arg;
+    srecord::interval result;
+    srecord::interval rest = arg;
+    while (!rest.empty())
+    {
+        srecord::interval piece = rest;
+        piece.first_interval_only();
+        rest -= piece;
+
+        uint32_t lo = piece.get_lowest();
+        uint32_t size = piece.get_highest() - lo;
+        if (size == 0)
+        {
+            // the whole address space
+            return piece;
+        }
+        lo += nbytes;
+        uint64_t hi = uint64_t(lo) + size;
+        if (hi <= (uint64_t(1) << 32))
+            result += srecord::interval(lo, uint32_t(hi));
+        else
+        {
+            result += srecord::interval(lo, 0);
+            result += srecord::interval(0, uint32_t(hi));
+        }
+    }
+    return result;
+}
+
+
+void
+srecord::input_filter_fused::fuse_offset(uint32_t amount)
+{
+    nbytes += amount;
+    if (cropping)
+        range = shift(range, amount);
+    steps.push_back("offset " + hex(amount));
+}
+
+
+void
+srecord::input_filter_fused::fuse_crop(const interval &a_range)
+{
+    if (cropping)
+        range *= a_range;
+    else
+        range = a_range;
+    cropping = true;
+    steps.push_back("crop " + a_range.representation());
+}
+
+
+void
+srecord::input_filter_fused::fuse_map(const std::string &name,
+    const record::data_t *map)
+{
+    for (unsigned j = 0; j < 256; ++j)
+        table[j] = map[table[j]];
+    compile();
+    steps.push_back(name);
+}
+
+
+bool
+srecord::input_filter_fused::fuse_into(input_filter_fused &stage)
+    const
+{
+    //
+    // This stage is equivalent to an offset, then a crop (in output
+    // addresses), then a byte map.
+    //
+    stage.nbytes += nbytes;
+    if (stage.cropping)
+        stage.range = shift(stage.range, nbytes);
+    if (cropping)
+    {
+        if (stage.cropping)
+            stage.range *= range;
+        else
+            stage.range = range;
+        stage.cropping = true;
+    }
+    for (unsigned j = 0; j < 256; ++j)
+        stage.table[j] = table[stage.table[j]];
+    stage.compile();
+    stage.steps.insert(stage.steps.end(), steps.begin(), steps.end());
+    return true;
+}
+
+
+void
+srecord::input_filter_fused::compile()
+{
+    //
+    // The and, or, xor and not filters all compose to
+    // (x & and_mask) ^ xor_mask.
+    //
+    record::data_t b = table[0];
+    record::data_t a = table[255] ^ b;
+    bool is_and_xor = true;
+    for (unsigned j = 0; j < 256; ++j)
+    {
+        if (table[j] != ((j & a) ^ b))
+        {
+            is_and_xor = false;
+            break;
+        }
+    }
+    if (is_and_xor)
+    {
+        and_mask = a;
+        xor_mask = b;
+        kernel = (a == 0xFF && b == 0 ? kernel_none : kernel_and_xor);
+        return;
+    }
+
+    record::data_t reference[256];
+    for (unsigned j = 0; j < 256; ++j)
+        reference[j] = j;
+    byte_transform_bitrev(reference, sizeof(reference));
+    if (0 == memcmp(reference, table, sizeof(table)))
+    {
+        kernel = kernel_bitrev;
+        return;
+    }
+
+    for (unsigned j = 0; j < 256; ++j)
+        reference[j] = j;
+    byte_transform_nibble_swap(reference, sizeof(reference));
+    if (0 == memcmp(reference, table, sizeof(table)))
+    {
+        kernel = kernel_nibble_swap;
+        return;
+    }
+
+    kernel = kernel_lookup;
+}
+
+
+void
+srecord::input_filter_fused::transform(record &result)
+    const
+{
+    record::data_t *p = result.get_data();
+    size_t len = result.get_length();
+    switch (kernel)
+    {
+    case kernel_none:
+        break;
+
+    case kernel_and_xor:
+        if (and_mask != 0xFF)
+            byte_transform_and(p, len, and_mask);
+        if (xor_mask != 0)
+            byte_transform_xor(p, len, xor_mask);
+        break;
+
+    case kernel_bitrev:
+        byte_transform_bitrev(p, len);
+        break;
+
+    case kernel_nibble_swap:
+        byte_transform_nibble_swap(p, len);
+        break;
+
+    case kernel_lookup:
+        for (size_t j = 0; j < len; ++j)
+            p[j] = table[p[j]];
+        break;
+    }
+}
+
+
+bool
+srecord::input_filter_fused::read(record &result)
+{
+    if (!cropping)
+    {
+        //
+        // Without a crop, each record maps to exactly one record,
+        // so there is no need to hold on to it.
+        //
+        if (!input_filter::read(result))
+            return false;
+        result.set_address(result.get_address() + nbytes);
+        if (result.get_type() == record::type_data)
+            transform(result);
+        return true;
+    }
+
+    for (;;)
+    {
+        //
+        // If we are not holding any current data,
+        // fetch another record from our input.
+        //
+        if (data_range.empty())
+        {
+            if (!input_filter::read(data))
+                return false;
+            data.set_address(data.get_address() + nbytes);
+            switch (data.get_type())
+            {
+            default:
+                result = data;
+                return true;
+
+            case record::type_data:
+                data_range =
+                    interval
+                    (
+                        data.get_address(),
+                        data.get_address() + data.get_length()
+                    );
+                break;
+
+            case record::type_execution_start_address:
+                if (!range.member(data.get_address()))
+                    continue;
+                result = data;
+                return true;
+            }
+        }
+
+        //
+        // Hand out the first piece of the held data which falls
+        // within the crop range.  Only the bytes handed out are
+        // transformed.
+        //
+        interval fragment = range * data_range;
+        if (fragment.empty())
+        {
+            data_range = interval();
+            continue;
+        }
+        fragment.first_interval_only();
+        interval::data_t lo = fragment.get_lowest();
+        interval::data_t hi = fragment.get_highest();
+        result =
+            record
+            (
+                record::type_data,
+                lo,
+                data.get_data() + lo - data.get_address(),
+                hi - lo
+            );
+        transform(result);
+        data_range -= fragment;
+        return true;
+    }
+}
+
+
+std::string
+srecord::input_filter_fused::describe()
+    const
+{
+    std::string result = "fused:";
+    for (size_t j = 0; j < steps.size(); ++j)
+    {
+        result += (j ? ", " : " ");
+        result += steps[j];
+    }
+    std::vector<std::string> parts;
+    if (nbytes)
+        parts.push_back("offset " + hex(nbytes));
+    if (cropping)
+        parts.push_back("crop " + range.representation());
+    switch (kernel)
+    {
+    case kernel_none:
+        break;
+
+    case kernel_and_xor:
+        parts.push_back("and " + hex(and_mask) + ", xor " + hex(xor_mask));
+        break;
+
+    case kernel_bitrev:
+        parts.push_back("bit reverse");
+        break;
+
+    case kernel_nibble_swap:
+        parts.push_back("nibble swap");
+        break;
+
+    case kernel_lookup:
+        parts.push_back("lookup table");
+        break;
+    }
+    if (parts.empty())
+        parts.push_back("pass through");
+    result += " =>";
+    for (size_t j = 0; j < parts.size(); ++j)
+    {
+        result += (j ? ", " : " ");
+        result += parts[j];
+    }
+    return result;
+}
+
+
+/**
+  * The filter_name function is used to obtain a readable name for a
+  * filter which has not been fused, for the plan.
+  */
+static std::string
+filter_name(const srecord::input &arg)
+{
+    const char *name = typeid(arg).name();
+#ifdef __GNUC__
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(name, 0, 0, &status);
+    if (demangled)
+    {
+        std::string result = demangled;
+        free(demangled);
+        return result;
+    }
+#endif
+    return name;
+}
+
+
+std::string
+srecord::input_filter_fused::plan(const input::pointer &chain)
+{
+    std::string result;
+    input::pointer ip = chain;
+    for (;;)
+    {
+        auto fp = std::dynamic_pointer_cast<input_filter>(ip);
+        if (!fp)
+            break;
+        auto stage = std::dynamic_pointer_cast<input_filter_fused>(fp);
+        result += "    ";
+        result += (stage ? stage->describe() : filter_name(*fp));
+        result += '\n';
+        ip = fp->get_deeper();
+    }
+    result += "    ";
+    result += ip->get_file_format_name();
+    result += ": ";
+    result += ip->filename();
+    result += '\n';
+    return result;
+}
+
+
+srecord::input::pointer
+srecord::input_filter_fused::optimize(const input::pointer &chain)
+{
+    //
+    // Flatten the filter chain, outermost first.
+    //
+    std::vector<std::shared_ptr<input_filter>> filters;
+    input::pointer bottom = chain;
+    for (;;)
+    {
+        auto fp = std::dynamic_pointer_cast<input_filter>(bottom);
+        if (!fp)
+            break;
+        filters.push_back(fp);
+        bottom = fp->get_deeper();
+    }
+
+    //
+    // Rebuild it from the bottom up, gathering each run of fusable
+    // filters into a single stage.
+    //
+    input::pointer result = bottom;
+    std::shared_ptr<input_filter_fused> stage;
+    for (auto it = filters.rbegin(); it != filters.rend(); ++it)
+    {
+        if (!stage)
+            stage.reset(new input_filter_fused(result));
+        if ((*it)->fuse_into(*stage))
+            continue;
+        if (!stage->steps.empty())
+            result = stage;
+        stage.reset();
+        (*it)->set_deeper(result);
+        result = *it;
+    }
+    if (stage && !stage->steps.empty())
+        result = stage;
+    return result;
+}
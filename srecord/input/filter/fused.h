@@ -0,0 +1,234 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_INPUT_FILTER_FUSED_H
+#define SRECORD_INPUT_FILTER_FUSED_H
+
+#include <string>
+#include <vector>
+
+#include <srecord/interval.h>
+#include <srecord/input/filter.h>
+#include <srecord/record.h>
+
+namespace srecord {
+
+/**
+  * The srecord::input_filter_fused class is used to represent a run of
+  * adjacent simple filters (offset, crop, exclude, and, or, xor, not,
+  * bit reverse, nibble swap) compiled into a single pass over the data.
+  *
+  * Address transforms collapse into one offset and one crop interval
+  * (expressed in output addresses), and the byte transforms, which do
+  * not care about addresses, collapse into one 256 entry lookup table.
+  * Each record is then read, re-addressed, cropped and transformed
+  * once, rather than once per filter.
+  */
+class input_filter_fused:
+    public input_filter
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~input_filter_fused() override = default;
+
+private:
+    /**
+      * The constructor.
+      *
+      * @param deeper
+      *     The incoming data source to be filtered
+      */
+    input_filter_fused(const input::pointer &deeper);
+
+public:
+    /**
+      * The optimize class method is used to replace every run of
+      * fusable filters in a filter chain with a single fused stage.
+      * Filters which can not be fused are left in place.
+      *
+      * @param chain
+      *     The outermost input of the filter chain to be optimised.
+      * @returns
+      *     the outermost input of the optimised filter chain.
+      */
+    static input::pointer optimize(const input::pointer &chain);
+
+    /**
+      * The plan class method is used to describe a filter chain, one
+      * line per stage, outermost first.  This is used by the
+      * -Filter_Plan option.
+      *
+      * @param chain
+      *     The outermost input of the filter chain to be described.
+      */
+    static std::string plan(const input::pointer &chain);
+
+    /**
+      * The fuse_offset method is used by offset filters to add
+      * themselves to this stage.
+      *
+      * @param nbytes
+      *     The number of bytes to offset the addresses by, modulo 2**32.
+      */
+    void fuse_offset(uint32_t nbytes);
+
+    /**
+      * The fuse_crop method is used by crop and exclude filters to add
+      * themselves to this stage.
+      *
+      * @param range
+      *     The address range to be preserved.
+      */
+    void fuse_crop(const interval &range);
+
+    /**
+      * The fuse_map method is used by the byte-wise filters to add
+      * themselves to this stage.
+      *
+      * @param name
+      *     The name of the filter, for the plan.
+      * @param table
+      *     The 256 entry table mapping each input byte value to its
+      *     output byte value.
+      */
+    void fuse_map(const std::string &name, const record::data_t *table);
+
+    // See base class for documentation.
+    bool fuse_into(input_filter_fused &stage) const override;
+
+protected:
+    // See base class for documentation.
+    bool read(record &record) override;
+
+private:
+    /**
+      * The nbytes instance variable is used to remember the total
+      * number of bytes to offset the addresses by.
+      */
+    record::address_t nbytes{0};
+
+    /**
+      * The cropping instance variable is used to remember whether or
+      * not any crop or exclude filters have been fused.
+      */
+    bool cropping{false};
+
+    /**
+      * The range instance variable is used to remember the address
+      * range to be preserved, in output addresses.  Only meaningful
+      * if #cropping is true.
+      */
+    interval range;
+
+    /**
+      * The table instance variable is used to remember the combined
+      * effect of all of the byte-wise filters.
+      */
+    record::data_t table[256];
+
+    /**
+      * The kernel_t enumeration is used to name the ways the #table
+      * may be applied to the data.  Most tables are equivalent to an
+      * AND and an XOR, or to a bit reverse or nibble swap, all of which
+      * have vectorised implementations (see srecord/byte_transform.h).
+      */
+    enum kernel_t
+    {
+        kernel_none,
+        kernel_and_xor,
+        kernel_bitrev,
+        kernel_nibble_swap,
+        kernel_lookup
+    };
+
+    /**
+      * The kernel instance variable is used to remember how the #table
+      * is to be applied to the data.
+      */
+    kernel_t kernel{kernel_none};
+
+    /**
+      * The and_mask instance variable is used to remember the AND
+      * mask, for kernel_and_xor.
+      */
+    record::data_t and_mask{0xFF};
+
+    /**
+      * The xor_mask instance variable is used to remember the XOR
+      * mask, for kernel_and_xor.
+      */
+    record::data_t xor_mask{0};
+
+    /**
+      * The steps instance variable is used to remember the names of
+      * the fused filters, innermost first, for the plan.
+      */
+    std::vector<std::string> steps;
+
+    /**
+      * The data instance variable is used to remember the current input
+      * data record being cropped.
+      */
+    record data;
+
+    /**
+      * The data_range instance variable is used to remember the address
+      * range of the current input data record still to be cropped.
+      */
+    interval data_range;
+
+    /**
+      * The compile method is used to pick the fastest #kernel for
+      * the current #table.
+      */
+    void compile();
+
+    /**
+      * The transform method is used to apply the #table to the data
+      * of a record, in place.
+      */
+    void transform(record &record) const;
+
+    /**
+      * The describe method is used to describe this stage for the plan.
+      */
+    std::string describe() const;
+
+public:
+    /**
+      * The default constructor.
+      */
+    input_filter_fused() = delete;
+
+    /**
+      * The copy constructor.
+      */
+    input_filter_fused(const input_filter_fused &) = delete;
+
+    /**
+      * The assignment operator.
+      */
+    input_filter_fused &operator=(const input_filter_fused &) = delete;
+};
+
+};
+
+#endif // SRECORD_INPUT_FILTER_FUSED_H
@@ -16,10 +16,20 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <algorithm>
+
 #include <srecord/input/filter/message.h>
+#include <srecord/memory/chunk.h>
 #include <srecord/record.h>
 
 
+//
+// How much forwarded data to let go of at a time.  Each forget_below
+// call shuffles the chunk table, so don't do it for every record.
+//
+static const uint32_t forget_batch = 64 * srecord::memory_chunk::size;
+
+
 srecord::input_filter_message::input_filter_message(
     const input::pointer &a_deeper,
     bool a_naked
@@ -38,19 +48,227 @@ srecord::input_filter_message::get_minimum_alignment()
 }
 
 
+void
+srecord::input_filter_message::add_late(const record &late)
+{
+    //
+    // Data which has already been passed on can't be taken back, so
+    // any bytes of it given again keep the value that was passed on.
+    //
+    uint32_t lo = late.get_address();
+    interval range(lo, lo + late.get_length());
+    interval again = range * passed;
+    if (!again.empty())
+    {
+        ifp->warning
+        (
+            "the data at %s arrived after it had been forwarded, the "
+                "values forwarded are kept",
+            again.representation().c_str()
+        );
+    }
+
+    //
+    // The rest is added to the buffer, to be forwarded once the result
+    // has been given.
+    //
+    range -= passed;
+    std::vector<uint32_t> edges;
+    range.get_runs(edges);
+    for (size_t j = 0; j < edges.size(); j += 2)
+    {
+        uint32_t run_lo = edges[j];
+        uint32_t run_hi = edges[j + 1];
+        buffer.add_record
+        (
+            ifp,
+            record
+            (
+                record::type_data,
+                run_lo,
+                late.get_data() + (run_lo - lo),
+                run_hi - run_lo
+            ),
+            defcon_ignore,
+            defcon_warning
+        );
+    }
+    if (!naked)
+        unforwarded += range;
+}
+
+
+void
+srecord::input_filter_message::combine_segments()
+{
+    //
+    // The data which arrived out of order (and only that data is in
+    // the buffer) fills in holes between the segments passed through.
+    // Observe each of its runs with a walker of its own, too.
+    //
+    std::vector<uint32_t> edges;
+    buffer.get_extents().get_runs(edges);
+    for (size_t j = 0; j < edges.size(); j += 2)
+    {
+        segment s;
+        s.address = edges[j];
+        s.end = edges[j + 1] ? edges[j + 1] : ((uint64_t)1 << 32);
+        s.walker = whole->slice();
+        uint64_t address = s.address;
+        while (address < s.end)
+        {
+            uint32_t ret_address = address;
+            uint8_t data[256];
+            size_t nbytes = sizeof(data);
+            if (nbytes > s.end - address)
+                nbytes = s.end - address;
+            buffer.find_next_data(ret_address, data, nbytes);
+            s.walker->observe(ret_address, data, nbytes);
+            address = (uint64_t)ret_address + nbytes;
+        }
+        segments.push_back(s);
+    }
+    std::sort
+    (
+        segments.begin(),
+        segments.end(),
+        [](const segment &lhs, const segment &rhs)
+            { return lhs.address < rhs.address; }
+    );
+
+    //
+    // Then put them all back together, in address order.
+    //
+    for (const segment &s : segments)
+        whole->combine(*s.walker, s.end - s.address);
+    whole->observe_end();
+}
+
+
 bool
 srecord::input_filter_message::read(record &result)
 {
+    if (!whole)
+    {
+        whole = create_walker();
+        keep_all = (whole->get_slice_alignment() != 1 || !whole->slice());
+        if (keep_all)
+        {
+            //
+            // The walker can't be cut into segments, so data arriving
+            // out of order could not be put back in order without a
+            // copy of all the data passed through.  Read all of it
+            // first, instead.
+            //
+            have_read_deeper = true;
+            buffer.reader(ifp, defcon_ignore, defcon_warning);
+            if (!naked)
+                unforwarded = buffer.get_extents();
+            record *rp = buffer.get_header();
+            if (rp)
+            {
+                result = *rp;
+                return true;
+            }
+        }
+    }
+
+    //
+    // Pass the deeper input through as it arrives, working out the
+    // result as we go, for as long as it arrives in address order.
+    //
+    while (!have_read_deeper)
+    {
+        if (!ifp->read(result))
+        {
+            have_read_deeper = true;
+            break;
+        }
+        switch (result.get_type())
+        {
+        case record::type_header:
+            // Pass on the first header only.
+            if (buffer.get_header())
+                break;
+            buffer.add_record(ifp, result, defcon_ignore, defcon_warning);
+            return true;
+
+        case record::type_data:
+            if (result.get_length() == 0)
+                break;
+            if
+            (
+                !out_of_order
+            &&
+                !segments.empty()
+            &&
+                result.get_address() < segments.back().end
+            )
+            {
+                //
+                // From here on, hold on to the data, rather than pass
+                // it through.  It will be forwarded after the result.
+                //
+                out_of_order = true;
+                for (const segment &s : segments)
+                    passed += interval(s.address, s.end);
+            }
+            if (out_of_order)
+            {
+                add_late(result);
+                break;
+            }
+
+            //
+            // A hole starts a new segment.
+            //
+            if (segments.empty() || result.get_address() > segments.back().end)
+            {
+                segment s;
+                s.address = result.get_address();
+                s.end = s.address;
+                s.walker = whole->slice();
+                segments.push_back(s);
+            }
+            segments.back().walker->observe
+            (
+                result.get_address(),
+                result.get_data(),
+                result.get_length()
+            );
+            segments.back().end =
+                (uint64_t)result.get_address() + result.get_length();
+            if (naked)
+                break;
+            return true;
+
+        default:
+            buffer.add_record(ifp, result, defcon_ignore, defcon_warning);
+            break;
+        }
+    }
+
     //
-    // If we haven't read the deeper input yet, read all of it into
-    // a memory buffer, then message the bytes.
+    // Calculate the result.
     //
-    if (buffer.empty())
+    if (!have_given_result)
     {
-        buffer.reader(ifp, defcon_ignore, defcon_warning);
+        have_given_result = true;
+
+        interval extents = buffer.get_extents();
+        for (const segment &s : segments)
+            extents += interval(s.address, s.end);
 
         unsigned multiple = get_minimum_alignment();
-        if (multiple >= 2 && !buffer.is_well_aligned(multiple))
+        std::vector<uint32_t> edges;
+        extents.get_runs(edges);
+        bool well_aligned = true;
+        for (uint32_t edge : edges)
+        {
+            if (multiple >= 2 && edge % multiple != 0)
+                well_aligned = false;
+        }
+        if (!well_aligned)
         {
             warning
             (
@@ -66,7 +284,7 @@ srecord::input_filter_message::read(record &result)
             );
         }
 
-        if (buffer.has_holes())
+        if (edges.size() > 2)
         {
             warning
             (
@@ -82,44 +300,47 @@ srecord::input_filter_message::read(record &result)
                 get_algorithm_name()
             );
         }
-    }
-
-    //
-    // Pass on the header of the deeper file.
-    //
-    if (!have_forwarded_header)
-    {
-        have_forwarded_header = true;
-        record *rp = buffer.get_header();
-        if (rp)
-        {
-            result = *rp;
-            return true;
-        }
-    }
 
-    //
-    // Calculate the result.
-    //
-    if (!have_given_result)
-    {
-        have_given_result = true;
-        process(buffer, result);
+        if (keep_all)
+            buffer.walk_parallel(whole);
+        else
+            combine_segments();
+        get_result(result);
+        whole.reset();
+        segments.clear();
+        if (unforwarded.empty())
+            buffer.forget_below(0xFFFFFFFF);
         return true;
     }
 
     //
     // Now forward the rest of the data.
     //
-    if (!naked)
+    if (!unforwarded.empty())
     {
-        uint32_t ret_address = buffer_pos;
+        interval run = unforwarded;
+        run.first_interval_only();
+        uint32_t ret_address = run.get_lowest();
         uint8_t data[64];
         size_t nbytes = sizeof(data);
+        if (nbytes > run.get_highest() - ret_address)
+            nbytes = run.get_highest() - ret_address;
         if (buffer.find_next_data(ret_address, data, nbytes))
         {
             result = record(record::type_data, ret_address, data, nbytes);
-            buffer_pos = ret_address + nbytes;
+            unforwarded -= interval(ret_address, ret_address + nbytes);
+
+            //
+            // Let go of the data already forwarded, a batch of chunks
+            // at a time, so that our reader's copy of the data and
+            // ours do not both have to be held in full.
+            //
+            uint32_t buffer_pos = ret_address + nbytes;
+            if (buffer_pos >= forgotten_pos + forget_batch)
+            {
+                buffer.forget_below(buffer_pos);
+                forgotten_pos = buffer_pos;
+            }
             return true;
         }
     }
@@ -19,8 +19,12 @@
 #ifndef SRECORD_INPUT_FILTER_MESSAGE_H
 #define SRECORD_INPUT_FILTER_MESSAGE_H
 
+#include <vector>
+
 #include <srecord/input/filter.h>
+#include <srecord/interval.h>
 #include <srecord/memory.h>
+#include <srecord/memory/walker.h>
 
 namespace srecord
 {
@@ -30,10 +34,17 @@ namespace srecord
   * base class for filters that must operate on the complete data, in
   * order, in order to functions (e.g. CRC, message digest, etc).
   *
-  * All of the machinery for accumulating the input data and eventually
-  * forwarding it on are in this common base class.  The only methods
-  * that a derived class must supply are data block processing and
-  * results creation.
+  * All of the machinery for passing the input data on, and working out
+  * the result from it, is in this common base class.  The only methods
+  * that a derived class must supply are a walker to work out the
+  * result, and the conversion of that result into a record.
+  *
+  * While the data arrives in ascending address order, it is passed on
+  * as it arrives, each run of it observed by a slice of the walker,
+  * and the result given at the end.  Data arriving out of order is
+  * held until the end, observed by slices of its own, and forwarded
+  * after the result.  Walkers which can't be sliced instead have all
+  * of the data read before the result is worked out.
   */
 class input_filter_message:
     public input_filter
@@ -60,14 +71,21 @@ class input_filter_message:
     bool read(record &record) override;
 
     /**
-      * The process method is used to process the data from the input.
+      * The create_walker method is used to start working out the
+      * result.  The data is passed to the walker in ascending address
+      * order, and the result then collected by the #get_result method.
+      * It may be called more than once, each time starting afresh.
+      */
+    virtual memory_walker::pointer create_walker() = 0;
+
+    /**
+      * The get_result method is used to turn the result worked out by
+      * the walker most recently made by #create_walker into a record.
       *
-      * @param input
-      *     The memory representation to be processed.
       * @param output
       *     The filter's output.
       */
-    virtual void process(const memory &input, record &output) = 0;
+    virtual void get_result(record &output) = 0;
 
     /**
       * The get_algorithm_name method is used in error messages.
@@ -89,24 +107,84 @@ class input_filter_message:
     bool naked;
 
     /**
-      * The buffer instance variable is used to remember the contents
-      * of the deeper file.  The deeper file must be read completely
-      * in order to calculate the result, and the input may be out of
-      * address order, necessitating this buffer.
+      * The buffer instance variable is used to remember the data which
+      * has not been passed through: all of it when #keep_all is set,
+      * otherwise only the data which arrived out of order.  Once the
+      * result is known, it is emptied progressively as the data is
+      * forwarded.
       */
     memory buffer;
 
     /**
-      * The buffer_pos instance variable is used to remember where we
-      * are up to in processing 'buffer'.
+      * The whole instance variable is used to remember the walker which
+      * works out the result.  When #keep_all is set, it walks the
+      * #buffer.  Otherwise it observes nothing itself, and the
+      * #segments are combined into it at the end.
+      */
+    memory_walker::pointer whole;
+
+    /**
+      * The keep_all instance variable is used to remember whether the
+      * #whole walker can't be cut into segments (see
+      * memory_walker::slice), and so all of the data must be read into
+      * the #buffer before any of it is forwarded.
+      */
+    bool keep_all{false};
+
+    /**
+      * The segment struct is used to remember a run of data, without
+      * holes, and the walker which has observed it.
       */
-    uint32_t buffer_pos{0};
+    struct segment
+    {
+        // The address of the first byte.
+        uint32_t address;
+
+        // The address one beyond the last byte.
+        uint64_t end;
+
+        // The walker which observed the bytes.
+        memory_walker::pointer walker;
+    };
 
     /**
-      * The have_forwarded_header instance variable is used to remember
-      * whether we have returned the file header to our reader yet.
+      * The segments instance variable is used to remember the runs of
+      * data passed through, in address order.  Each has a walker of
+      * its own, made with memory_walker::slice.
       */
-    bool have_forwarded_header{false};
+    std::vector<segment> segments;
+
+    /**
+      * The passed instance variable is used to remember the addresses
+      * of the data passed through before any arrived out of order.
+      */
+    interval passed;
+
+    /**
+      * The unforwarded instance variable is used to remember the
+      * addresses of the data which was not passed through.  It is
+      * forwarded from the #buffer once the result has been given.
+      */
+    interval unforwarded;
+
+    /**
+      * The forgotten_pos instance variable is used to remember the
+      * address below which the buffer's data has been forwarded and
+      * then discarded.
+      */
+    uint32_t forgotten_pos{0};
+
+    /**
+      * The have_read_deeper instance variable is used to remember
+      * whether we have read all of the deeper input yet.
+      */
+    bool have_read_deeper{false};
+
+    /**
+      * The out_of_order instance variable is used to remember whether
+      * any data has arrived below the end of the last of the #segments.
+      */
+    bool out_of_order{false};
 
     /**
       * The have_given_result instance variable is used to remember
@@ -121,6 +199,23 @@ class input_filter_message:
       */
     bool have_forwarded_start_address{false};
 
+    /**
+      * The add_late method is used to add data to the #buffer once some
+      * has arrived out of order.  Bytes which have already been passed
+      * on keep the value they were passed on with.
+      *
+      * @param late
+      *     The data record to be added.
+      */
+    void add_late(const record &late);
+
+    /**
+      * The combine_segments method is used to work out the result,
+      * when #keep_all is not set, by combining the #segments, and the
+      * runs of data which arrived out of order, into the #whole walker.
+      */
+    void combine_segments();
+
 public:
     /**
       * The default constructor.
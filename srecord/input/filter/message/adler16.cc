@@ -19,7 +19,6 @@
 
 #include <srecord/arglex/tool.h>
 #include <srecord/input/filter/message/adler16.h>
-#include <srecord/memory/walker/adler16.h>
 #include <srecord/record.h>
 
 
@@ -47,21 +46,26 @@ srecord::input_filter_message_adler16::create(const input::pointer &a_deeper,
 }
 
 
-void
-srecord::input_filter_message_adler16::process(const memory &input,
-    record &output)
+srecord::memory_walker::pointer
+srecord::input_filter_message_adler16::create_walker()
 {
     //
     // Now calculate the Adler 16 checksum the bytes in order from
     // lowest address to highest.  (Holes are ignored, not filled,
-    // warning already issued.)
+    // a warning is issued.)
     //
-    memory_walker_adler16::pointer w = memory_walker_adler16::create();
-    input.walk(w);
-    uint16_t adler = w->get();
+    walker = memory_walker_adler16::create();
+    return walker;
+}
+
+
+void
+srecord::input_filter_message_adler16::get_result(record &output)
+{
+    uint16_t adler = walker->get();
 
     //
-    // Turn the Adler-16 checksum into the first data record.
+    // Turn the Adler-16 checksum into a data record.
     //
     uint8_t chunk[2];
     record::encode(chunk, adler, sizeof(chunk), end);
@@ -19,7 +19,6 @@
 
 #include <srecord/arglex/tool.h>
 #include <srecord/input/filter/message/adler32.h>
-#include <srecord/memory/walker/adler32.h>
 #include <srecord/record.h>
 
 
@@ -47,22 +46,26 @@ srecord::input_filter_message_adler32::create(const input::pointer &a_deeper,
 }
 
 
-void
-srecord::input_filter_message_adler32::process(const memory &input,
-    record &output)
+srecord::memory_walker::pointer
+srecord::input_filter_message_adler32::create_walker()
 {
     //
     // Now calculate the Adler 32 checksum the bytes in order from
     // lowest address to highest.  (Holes are ignored, not filled,
-    // warning issued already.)
+    // a warning is issued.)
     //
-    memory_walker_adler32::pointer w =
-        memory_walker_adler32::create();
-    input.walk(w);
-    uint32_t adler = w->get();
+    walker = memory_walker_adler32::create();
+    return walker;
+}
+
+
+void
+srecord::input_filter_message_adler32::get_result(record &output)
+{
+    uint32_t adler = walker->get();
 
     //
-    // Turn the CRC into the first data record.
+    // Turn the CRC into a data record.
     //
     uint8_t chunk[4];
     record::encode(chunk, adler, sizeof(chunk), end);
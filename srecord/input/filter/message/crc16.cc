@@ -20,7 +20,6 @@
 #include <srecord/arglex/tool.h>
 #include <srecord/input/filter/message/crc16.h>
 #include <srecord/memory.h>
-#include <srecord/memory/walker/crc16.h>
 #include <srecord/record.h>
 
 
@@ -124,15 +123,14 @@ srecord::input_filter_message_crc16::command_line(arglex_tool *cmdln)
 }
 
 
-void
-srecord::input_filter_message_crc16::process(const memory &buffer,
-    record &result)
+srecord::memory_walker::pointer
+srecord::input_filter_message_crc16::create_walker()
 {
     //
     // Now CRC16 the bytes in order from lowest address to highest.
-    // (Holes are ignored, not filled, warning already issued.)
+    // (Holes are ignored, not filled, a warning is issued.)
     //
-    memory_walker_crc16::pointer w =
+    walker =
         memory_walker_crc16::create
         (
             seed_mode,
@@ -140,11 +138,17 @@ srecord::input_filter_message_crc16::process(const memory &buffer,
             polynomial,
             bitdir
         );
-    buffer.walk(w);
-    unsigned crc = w->get();
+    return walker;
+}
+
+
+void
+srecord::input_filter_message_crc16::get_result(record &result)
+{
+    unsigned crc = walker->get();
 
     //
-    // Turn the CRC into the first data record.
+    // Turn the CRC into a data record.
     //
     uint8_t chunk[2];
     record::encode(chunk, crc, sizeof(chunk), end);
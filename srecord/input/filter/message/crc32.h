@@ -23,6 +23,7 @@
 #include <srecord/crc32.h>
 #include <srecord/endian.h>
 #include <srecord/input/filter/message.h>
+#include <srecord/memory/walker/crc32.h>
 
 namespace srecord
 {
@@ -74,7 +75,10 @@ class input_filter_message_crc32:
     void command_line(arglex_tool *cmdln) override;
 
     // See base class for documentation.
-    void process(const memory &input, record &output) override;
+    memory_walker::pointer create_walker() override;
+
+    // See base class for documentation.
+    void get_result(record &output) override;
 
     // See base class for documentation.
     const char *get_algorithm_name() const override;
@@ -99,6 +103,12 @@ class input_filter_message_crc32:
       */
     crc32::seed_mode_t seed_mode;
 
+    /**
+      * The walker instance variable is used to remember the walker
+      * working out the checksum, as made by #create_walker.
+      */
+    memory_walker_crc32::pointer walker;
+
 public:
     /**
       * The default constructor.
@@ -0,0 +1,215 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstdlib>
+
+#include <srecord/arglex/tool.h>
+#include <srecord/input/filter/message/crc_rocksoft.h>
+#include <srecord/record.h>
+
+
+srecord::input_filter_message_crc_rocksoft::input_filter_message_crc_rocksoft(
+    const input::pointer &a_deeper,
+    uint32_t a_address,
+    endian_t a_end
+) :
+    input_filter_message(a_deeper),
+    address(a_address),
+    end(a_end),
+    parameters(crc_rocksoft::model_by_name("crc-32"))
+{
+}
+
+
+srecord::input::pointer
+srecord::input_filter_message_crc_rocksoft::create(
+    const input::pointer &a_deeper, uint32_t a_address, endian_t a_end)
+{
+    return
+        pointer
+        (
+            new input_filter_message_crc_rocksoft(a_deeper, a_address, a_end)
+        );
+}
+
+
+/**
+  * The get_parameter function is used to read the numeric value of a
+  * CRC parameter.  The arglex numbers are only long, and a 64-bit
+  * polynomial or seed does not fit, so the text is parsed again.
+  */
+static uint64_t
+get_parameter(srecord::arglex_tool *cmdln, const char *caption)
+{
+    if (cmdln->token_next() != srecord::arglex::token_number)
+        cmdln->fatal_error("the %s modifier requires a number", caption);
+    uint64_t result = strtoull(cmdln->value_string().c_str(), 0, 0);
+    cmdln->token_next();
+    return result;
+}
+
+
+void
+srecord::input_filter_message_crc_rocksoft::command_line(arglex_tool *cmdln)
+{
+    //
+    // Changing any of the parameters of a preset makes it a custom
+    // model, with its table worked out at run time.
+    //
+    bool custom = false;
+    for (;;)
+    {
+        switch (cmdln->token_cur())
+        {
+        case arglex_tool::token_crc_model:
+            if (cmdln->token_next() != arglex::token_string)
+                cmdln->fatal_error("the -model modifier requires a name");
+            parameters =
+                crc_rocksoft::model_by_name(cmdln->value_string().c_str());
+            custom = false;
+            cmdln->token_next();
+            break;
+
+        case arglex_tool::token_crc_width:
+            {
+                //
+                // A width starts a new model from scratch, rather than
+                // inheriting the preset's seed and final exclusive-or.
+                //
+                uint64_t width = get_parameter(cmdln, "-width");
+                if (width < 1 || width > 64)
+                {
+                    cmdln->fatal_error
+                    (
+                        "the CRC width must be from 1 to 64 bits, not %llu",
+                        (unsigned long long)width
+                    );
+                }
+                parameters.width = width;
+                parameters.polynomial = 0;
+                parameters.initial = 0;
+                parameters.reflect_in = false;
+                parameters.reflect_out = false;
+                parameters.xor_out = 0;
+                custom = true;
+            }
+            break;
+
+        case arglex_tool::token_polynomial:
+            parameters.polynomial = get_parameter(cmdln, "-polynomial");
+            custom = true;
+            break;
+
+        case arglex_tool::token_crc_initial:
+            parameters.initial = get_parameter(cmdln, "-initial");
+            custom = true;
+            break;
+
+        case arglex_tool::token_crc_xor_out:
+            parameters.xor_out = get_parameter(cmdln, "-xor-out");
+            custom = true;
+            break;
+
+        case arglex_tool::token_crc_reflect_in:
+            parameters.reflect_in = true;
+            custom = true;
+            cmdln->token_next();
+            break;
+
+        case arglex_tool::token_crc_reflect_out:
+            parameters.reflect_out = true;
+            custom = true;
+            cmdln->token_next();
+            break;
+
+        default:
+            if (custom)
+            {
+                unsigned width = parameters.width;
+                uint64_t limit =
+                    (width >= 64 ? ~(uint64_t)0 : ((uint64_t)1 << width) - 1);
+                if (parameters.polynomial == 0)
+                    cmdln->fatal_error("the CRC needs a -polynomial");
+                if
+                (
+                    parameters.polynomial > limit
+                ||
+                    parameters.initial > limit
+                ||
+                    parameters.xor_out > limit
+                )
+                {
+                    cmdln->fatal_error
+                    (
+                        "the CRC polynomial, initial value and final "
+                            "exclusive-or must fit in %u bits",
+                        width
+                    );
+                }
+                parameters.name = "CRC";
+                parameters.check = 0;
+                parameters.table = nullptr;
+            }
+            return;
+        }
+    }
+}
+
+
+srecord::memory_walker::pointer
+srecord::input_filter_message_crc_rocksoft::create_walker()
+{
+    //
+    // Now CRC the bytes in order from lowest address to highest.
+    // (Holes are ignored, not filled, a warning is issued.)
+    //
+    walker = memory_walker_crc_rocksoft::create(parameters);
+    return walker;
+}
+
+
+void
+srecord::input_filter_message_crc_rocksoft::get_result(record &output)
+{
+    uint64_t crc = walker->get();
+
+    //
+    // Turn the CRC into a data record, using as few bytes as
+    // will hold the width.
+    //
+    size_t nbytes = (parameters.width + 7) / 8;
+    uint8_t chunk[8];
+    for (size_t j = 0; j < nbytes; ++j)
+    {
+        uint8_t c = crc >> (8 * j);
+        if (end == endian_big)
+            chunk[nbytes - 1 - j] = c;
+        else
+            chunk[j] = c;
+    }
+    output = record(record::type_data, address, chunk, nbytes);
+}
+
+
+const char *
+srecord::input_filter_message_crc_rocksoft::get_algorithm_name()
+    const
+{
+    return parameters.name;
+}
@@ -0,0 +1,135 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_INPUT_FILTER_MESSAGE_CRC_ROCKSOFT_H
+#define SRECORD_INPUT_FILTER_MESSAGE_CRC_ROCKSOFT_H
+
+#include <srecord/crc_rocksoft.h>
+#include <srecord/endian.h>
+#include <srecord/input/filter/message.h>
+#include <srecord/memory/walker/crc_rocksoft.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::input_filter_message_crc_rocksoft class is used to
+  * represent the state of a checksum filter that inserts a CRC into the
+  * data, the CRC algorithm being described by the Rocksoft model
+  * parameters (width, polynomial, initial value, input and output
+  * reflection, and final exclusive-or).
+  */
+class input_filter_message_crc_rocksoft:
+    public input_filter_message
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~input_filter_message_crc_rocksoft() override = default;
+
+private:
+    /**
+      * The constructor.
+      *
+      * @param deeper
+      *     The incoming data source to be filtered
+      * @param address
+      *     where to place the checksum
+      * @param end
+      *     The byte order.
+      */
+    input_filter_message_crc_rocksoft(const input::pointer &deeper,
+        uint32_t address, endian_t end);
+
+public:
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      *
+      * @param deeper
+      *     The incoming data source to be filtered
+      * @param address
+      *     where to place the checksum
+      * @param end
+      *     The byte order.
+      */
+    static pointer create(const input::pointer &deeper, uint32_t address,
+        endian_t end);
+
+protected:
+    // See base class for documentation.
+    void command_line(arglex_tool *cmdln) override;
+
+    // See base class for documentation.
+    memory_walker::pointer create_walker() override;
+
+    // See base class for documentation.
+    void get_result(record &output) override;
+
+    // See base class for documentation.
+    const char *get_algorithm_name() const override;
+
+private:
+    /**
+      * The address instance variable is used to remember where to place
+      * the CRC in memory.
+      */
+    uint32_t address;
+
+    /**
+      * The end instance variable is used to remember whether the byte
+      * order is big-endian or little-endian.
+      */
+    endian_t end;
+
+    /**
+      * The parameters instance variable is used to remember which CRC
+      * algorithm the user wants.  The default is the CRC-32 preset.
+      */
+    crc_rocksoft::model parameters;
+
+    /**
+      * The walker instance variable is used to remember the walker
+      * working out the checksum, as made by #create_walker.
+      */
+    memory_walker_crc_rocksoft::pointer walker;
+
+public:
+    /**
+      * The default constructor.
+      */
+    input_filter_message_crc_rocksoft() = delete;
+
+    /**
+      * The copy constructor.
+      */
+    input_filter_message_crc_rocksoft(
+        const input_filter_message_crc_rocksoft &) = delete;
+
+    /**
+      * The assignment operator.
+      */
+    input_filter_message_crc_rocksoft &operator=(
+        const input_filter_message_crc_rocksoft &) = delete;
+};
+
+};
+
+#endif // SRECORD_INPUT_FILTER_MESSAGE_CRC_ROCKSOFT_H
@@ -0,0 +1,72 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/input/filter/message/digest.h>
+#include <srecord/memory/walker/digest.h>
+#include <srecord/quit.h>
+#include <srecord/record.h>
+
+
+srecord::input_filter_message_digest::input_filter_message_digest(
+    const input::pointer &a_deeper,
+    uint32_t a_address,
+    const digest::pointer &a_calc
+) :
+    input_filter_message(a_deeper),
+    address(a_address),
+    calc(a_calc)
+{
+}
+
+
+srecord::input::pointer
+srecord::input_filter_message_digest::create(const input::pointer &a_deeper,
+    uint32_t a_address, const char *name)
+{
+    digest::pointer calc = digest::create(name);
+    if (!calc)
+        quit_default.fatal_error("message digest \"%s\" unknown", name);
+    return pointer(new input_filter_message_digest(a_deeper, a_address, calc));
+}
+
+
+srecord::memory_walker::pointer
+srecord::input_filter_message_digest::create_walker()
+{
+    // Each walk needs a digest of its own, starting afresh.
+    calc = digest::create(calc->get_name());
+    return memory_walker_digest::create(calc);
+}
+
+
+void
+srecord::input_filter_message_digest::get_result(record &output)
+{
+    uint8_t data[64];
+    calc->get(data);
+    output = record(record::type_data, address, data, calc->get_size());
+}
+
+
+const char *
+srecord::input_filter_message_digest::get_algorithm_name()
+    const
+{
+    return calc->get_name();
+}
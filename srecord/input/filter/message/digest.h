@@ -0,0 +1,119 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_INPUT_FILTER_MESSAGE_DIGEST_H
+#define SRECORD_INPUT_FILTER_MESSAGE_DIGEST_H
+
+#include <srecord/digest.h>
+#include <srecord/input/filter/message.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::input_filter_message_digest class is used to represent
+  * a filter that runs the data through one of the message digests
+  * built in to SRecord, and inserts the result into the data.  Unlike
+  * srecord::input_filter_message_gcrypt it does not need the libgcrypt
+  * library.
+  */
+class input_filter_message_digest:
+    public input_filter_message
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~input_filter_message_digest() override = default;
+
+private:
+    /**
+      * The constructor.  It is private on purpose, use the #create
+      * class method instead.
+      *
+      * @param deeper
+      *     The source of data to be filtered.
+      * @param address
+      *     Where to place the digest in memory.
+      * @param calc
+      *     The message digest calculation to use.
+      */
+    input_filter_message_digest(const input::pointer &deeper,
+        uint32_t address, const digest::pointer &calc);
+
+public:
+    /**
+      * The create class method is used to create a new dynamically
+      * allocated instance of this class.
+      *
+      * @param deeper
+      *     The source of data to be filtered.
+      * @param address
+      *     Where to place the digest in memory.
+      * @param name
+      *     The name of the digest, see srecord::digest::create.  It is
+      *     a fatal error if this is not one of the built in digests.
+      */
+    static pointer create(const input::pointer &deeper, uint32_t address,
+        const char *name);
+
+protected:
+    // See base class for documentation.
+    memory_walker::pointer create_walker() override;
+
+    // See base class for documentation.
+    void get_result(record &output) override;
+
+    // See base class for documentation.
+    const char *get_algorithm_name() const override;
+
+private:
+    /**
+      * The address instance variable is used to remember where to place
+      * the digest in memory.
+      */
+    uint32_t address;
+
+    /**
+      * The calc instance variable is used to remember the message
+      * digest calculation to use.
+      */
+    digest::pointer calc;
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    input_filter_message_digest() = delete;
+
+    /**
+      * The copy constructor.  Do not use.
+      */
+    input_filter_message_digest(const input_filter_message_digest &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    input_filter_message_digest &operator=(
+        const input_filter_message_digest &) = delete;
+};
+
+};
+
+#endif // SRECORD_INPUT_FILTER_MESSAGE_DIGEST_H
@@ -18,7 +18,6 @@
 
 #include <srecord/arglex/tool.h>
 #include <srecord/input/filter/message/fletcher16.h>
-#include <srecord/memory/walker/fletcher16.h>
 #include <srecord/record.h>
 
 srecord::input_filter_message_fletcher16::input_filter_message_fletcher16(
@@ -61,22 +60,26 @@ srecord::input_filter_message_fletcher16::command_line(
 }
 
 
-void
-srecord::input_filter_message_fletcher16::process(const memory &input,
-    record &output)
+srecord::memory_walker::pointer
+srecord::input_filter_message_fletcher16::create_walker()
 {
     //
     // Now calculate the Fletcher 16 checksum the bytes in order from
     // lowest address to highest.  (Holes are ignored, not filled,
-    // warning issued already.)
+    // a warning is issued.)
     //
-    memory_walker_fletcher16::pointer w =
-        memory_walker_fletcher16::create(sum1, sum2, answer, end);
-    input.walk(w);
-    uint16_t fletcher = w->get();
+    walker = memory_walker_fletcher16::create(sum1, sum2, answer, end);
+    return walker;
+}
+
+
+void
+srecord::input_filter_message_fletcher16::get_result(record &output)
+{
+    uint16_t fletcher = walker->get();
 
     //
-    // Turn the Fletcher-16 checksum into the first data record.
+    // Turn the Fletcher-16 checksum into a data record.
     //
     uint8_t chunk[2];
     record::encode(chunk, fletcher, sizeof(chunk), end);
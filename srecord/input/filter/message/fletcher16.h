@@ -22,6 +22,7 @@
 #include <srecord/fletcher16.h>
 #include <srecord/endian.h>
 #include <srecord/input/filter/message.h>
+#include <srecord/memory/walker/fletcher16.h>
 
 namespace srecord
 {
@@ -71,7 +72,10 @@ class input_filter_message_fletcher16:
 
 protected:
     // See base class for documentation.
-    void process(const memory &input, record &output) override;
+    memory_walker::pointer create_walker() override;
+
+    // See base class for documentation.
+    void get_result(record &output) override;
 
     // See base class for documentation.
     const char *get_algorithm_name() const override;
@@ -98,6 +102,12 @@ class input_filter_message_fletcher16:
 
     int answer{-1};
 
+    /**
+      * The walker instance variable is used to remember the walker
+      * working out the checksum, as made by #create_walker.
+      */
+    memory_walker_fletcher16::pointer walker;
+
 public:
     /**
       * The default constructor.
@@ -18,7 +18,6 @@
 
 #include <srecord/arglex/tool.h>
 #include <srecord/input/filter/message/fletcher32.h>
-#include <srecord/memory/walker/fletcher32.h>
 #include <srecord/record.h>
 
 srecord::input_filter_message_fletcher32::input_filter_message_fletcher32(
@@ -46,22 +45,26 @@ srecord::input_filter_message_fletcher32::create(
 }
 
 
-void
-srecord::input_filter_message_fletcher32::process(const memory &input,
-    record &output)
+srecord::memory_walker::pointer
+srecord::input_filter_message_fletcher32::create_walker()
 {
     //
     // Now calculate the Fletcher 32 checksum the bytes in order from
     // lowest address to highest.  (Holes are ignored, not filled,
-    // warning issued already.)
+    // a warning is issued.)
     //
-    memory_walker_fletcher32::pointer w =
-        memory_walker_fletcher32::create();
-    input.walk(w);
-    uint32_t fletcher = w->get();
+    walker = memory_walker_fletcher32::create();
+    return walker;
+}
+
+
+void
+srecord::input_filter_message_fletcher32::get_result(record &output)
+{
+    uint32_t fletcher = walker->get();
 
     //
-    // Turn the CRC into the first data record.
+    // Turn the CRC into a data record.
     //
     uint8_t chunk[4];
     record::encode(chunk, fletcher, sizeof(chunk), end);
@@ -18,8 +18,8 @@
 
 #include <srecord/quit.h>
 #include <srecord/sizeof.h>
+#include <srecord/input/filter/message/digest.h>
 #include <srecord/input/filter/message/gcrypt.h>
-#include <srecord/memory/walker/gcrypt.h>
 #include <srecord/record.h>
 
 srecord::input_filter_message_gcrypt::input_filter_message_gcrypt(
@@ -36,6 +36,15 @@ srecord::input_filter_message_gcrypt::input_filter_message_gcrypt(
 }
 
 
+srecord::input_filter_message_gcrypt::~input_filter_message_gcrypt()
+{
+#ifdef HAVE_LIBGCRYPT
+    if (handle)
+        gcry_md_close(handle);
+#endif
+}
+
+
 srecord::input::pointer
 srecord::input_filter_message_gcrypt::create(const input::pointer &a_deeper,
     uint32_t a_address, int algo, bool hmac)
@@ -58,6 +67,11 @@ srecord::input::pointer
 srecord::input_filter_message_gcrypt::create(const input::pointer &a_deeper,
     uint32_t a_address, const char *name, bool a_hmac)
 {
+#ifndef HAVE_LIBGCRYPT
+    // The common digests are built in, even without libgcrypt.
+    if (!a_hmac && digest::create(name))
+        return input_filter_message_digest::create(a_deeper, a_address, name);
+#endif
     return create(a_deeper, a_address, algorithm_from_name(name), a_hmac);
 }
 
@@ -69,10 +83,7 @@ srecord::input_filter_message_gcrypt::create_md5(
 #ifdef HAVE_LIBGCRYPT
     return create(a_deeper, a_address, GCRY_MD_MD5);
 #else
-    (void)a_deeper;
-    (void)a_address;
-    quit_default.fatal_error("libgcrypt not available");
-    return pointer();
+    return input_filter_message_digest::create(a_deeper, a_address, "MD5");
 #endif
 }
 
@@ -84,10 +95,7 @@ srecord::input_filter_message_gcrypt::create_sha1(
 #ifdef HAVE_LIBGCRYPT
     return create(a_deeper, a_address, GCRY_MD_SHA1);
 #else
-    (void)a_deeper;
-    (void)a_address;
-    quit_default.fatal_error("libgcrypt not available");
-    return pointer();
+    return input_filter_message_digest::create(a_deeper, a_address, "SHA1");
 #endif
 }
 
@@ -159,10 +167,7 @@ srecord::input_filter_message_gcrypt::create_sha256(
 #ifdef HAVE_LIBGCRYPT
     return create(a_deeper, a_address, GCRY_MD_SHA256);
 #else
-    (void)a_deeper;
-    (void)a_address;
-    quit_default.fatal_error("libgcrypt not available");
-    return pointer();
+    return input_filter_message_digest::create(a_deeper, a_address, "SHA256");
 #endif
 }
 
@@ -174,10 +179,7 @@ srecord::input_filter_message_gcrypt::create_sha384(
 #ifdef HAVE_LIBGCRYPT
     return create(a_deeper, a_address, GCRY_MD_SHA384);
 #else
-    (void)a_deeper;
-    (void)a_address;
-    quit_default.fatal_error("libgcrypt not available");
-    return pointer();
+    return input_filter_message_digest::create(a_deeper, a_address, "SHA384");
 #endif
 }
 
@@ -189,10 +191,7 @@ srecord::input_filter_message_gcrypt::create_sha512(
 #ifdef HAVE_LIBGCRYPT
     return create(a_deeper, a_address, GCRY_MD_SHA512);
 #else
-    (void)a_deeper;
-    (void)a_address;
-    quit_default.fatal_error("libgcrypt not available");
-    return pointer();
+    return input_filter_message_digest::create(a_deeper, a_address, "SHA512");
 #endif
 }
 
@@ -204,10 +203,7 @@ srecord::input_filter_message_gcrypt::create_sha224(
 #ifdef HAVE_LIBGCRYPT_SHA224
     return create(a_deeper, a_address, GCRY_MD_SHA224);
 #else
-    (void)a_deeper;
-    (void)a_address;
-    quit_default.fatal_error("libgcrypt SHA224 not available");
-    return pointer();
+    return input_filter_message_digest::create(a_deeper, a_address, "SHA224");
 #endif
 }
 
@@ -326,24 +322,31 @@ srecord::input_filter_message_gcrypt::algorithm_from_name(const char *name)
 }
 
 
-void
-srecord::input_filter_message_gcrypt::process(const memory &input,
-    record &output)
+srecord::memory_walker::pointer
+srecord::input_filter_message_gcrypt::create_walker()
 {
 #ifdef HAVE_LIBGCRYPT
-    // allocate the message digest handle
+    // Each walk needs a message digest handle of its own.
+    if (handle)
+        gcry_md_close(handle);
+    handle = 0;
     unsigned int flags = 0;
     if (hmac)
         flags |= GCRY_MD_FLAG_HMAC;
-    gcry_md_hd_t handle = 0;
     gcry_error_t err = gcry_md_open(&handle, algo, flags);
     if (err)
         fatal_error("gcry_md_open: %s", gcry_strerror(err));
+#else
+    fatal_error("not compiled with libgcrypt support");
+#endif
+    return memory_walker_gcrypt::create(handle);
+}
 
-    // traverse the memory
-    memory_walker::pointer w = memory_walker_gcrypt::create(handle);
-    input.walk(w);
 
+void
+srecord::input_filter_message_gcrypt::get_result(record &output)
+{
+#ifdef HAVE_LIBGCRYPT
     // generate the result
     const uint8_t *data = gcry_md_read(handle, algo);
     size_t data_size = gcry_md_get_algo_dlen(algo);
@@ -351,9 +354,8 @@ srecord::input_filter_message_gcrypt::process(const memory &input,
 
     // free the message digest handle
     gcry_md_close(handle);
+    handle = 0;
 #else
-    (void)input;
-    fatal_error("not compiled with libgcrypt support");
     output =
         record
         (
@@ -20,6 +20,7 @@
 #define SRECORD_INPUT_FILTER_MESSAGE_GCRYPT_H
 
 #include <srecord/input/filter/message.h>
+#include <srecord/memory/walker/gcrypt.h>
 
 namespace srecord
 {
@@ -39,7 +40,7 @@ class input_filter_message_gcrypt:
     /**
       * The destructor.
       */
-    ~input_filter_message_gcrypt() override = default;
+    ~input_filter_message_gcrypt() override;
 
 private:
     /**
@@ -294,7 +295,10 @@ class input_filter_message_gcrypt:
 
 protected:
     // See base class for documentation.
-    void process(const memory &input, record &output) override;
+    memory_walker::pointer create_walker() override;
+
+    // See base class for documentation.
+    void get_result(record &output) override;
 
     // See base class for documentation.
     const char *get_algorithm_name() const override;
@@ -318,6 +322,13 @@ class input_filter_message_gcrypt:
       */
     uint32_t address;
 
+    /**
+      * The handle instance variable is used to remember the libgcrypt
+      * handle of the message digest being calculated, as opened by
+      * #create_walker, or NULL if none is open.
+      */
+    gcry_md_hd_t handle{0};
+
 public:
     /**
       * The default constructor.
@@ -0,0 +1,107 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/input/filter/message/multi.h>
+#include <srecord/memory/walker/multi.h>
+#include <srecord/quit.h>
+#include <srecord/record.h>
+
+
+srecord::input_filter_message_multi::input_filter_message_multi(
+    const input::pointer &a_deeper,
+    uint32_t a_address,
+    const digests_t &a_digests
+) :
+    input_filter_message(a_deeper),
+    address(a_address),
+    digests(a_digests)
+{
+    for (const named_digest::pointer &dp : digests)
+    {
+        if (!algorithm_name.empty())
+            algorithm_name += ", ";
+        algorithm_name += dp->get_name();
+    }
+}
+
+
+srecord::input::pointer
+srecord::input_filter_message_multi::create(const input::pointer &a_deeper,
+    uint32_t a_address, const digests_t &a_digests)
+{
+    size_t nbytes = 0;
+    for (const named_digest::pointer &dp : a_digests)
+        nbytes += dp->get_size();
+    if (nbytes > record::max_data_length)
+    {
+        quit_default.fatal_error
+        (
+            "the digests need %d bytes, more than the %d that fit in "
+                "one record",
+            (int)nbytes,
+            (int)record::max_data_length
+        );
+    }
+    return
+        pointer
+        (
+            new input_filter_message_multi(a_deeper, a_address, a_digests)
+        );
+}
+
+
+srecord::memory_walker::pointer
+srecord::input_filter_message_multi::create_walker()
+{
+    //
+    // One walker hands the data to all of the digests, so they are
+    // all worked out in the same pass.  (Holes are ignored, not
+    // filled, a warning is issued.)
+    //
+    memory_walker_multi::pointer w = memory_walker_multi::create();
+    for (const named_digest::pointer &dp : digests)
+        w->push_back(dp->start());
+    return w;
+}
+
+
+void
+srecord::input_filter_message_multi::get_result(record &output)
+{
+    //
+    // Turn the results into a single data record, each one following
+    // the one before.
+    //
+    uint8_t data[record::max_data_length];
+    size_t nbytes = 0;
+    for (const named_digest::pointer &dp : digests)
+    {
+        dp->get_bytes(data + nbytes);
+        nbytes += dp->get_size();
+    }
+    output = record(record::type_data, address, data, nbytes);
+}
+
+
+const char *
+srecord::input_filter_message_multi::get_algorithm_name()
+    const
+{
+    return algorithm_name.c_str();
+}
@@ -0,0 +1,131 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_INPUT_FILTER_MESSAGE_MULTI_H
+#define SRECORD_INPUT_FILTER_MESSAGE_MULTI_H
+
+#include <string>
+#include <vector>
+
+#include <srecord/input/filter/message.h>
+#include <srecord/named_digest.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::input_filter_message_multi class is used to represent
+  * a filter that works out several checksums and message digests in a
+  * single walk over the data, and inserts all of the results into the
+  * data, one after the other, starting at the given address.
+  */
+class input_filter_message_multi:
+    public input_filter_message
+{
+public:
+    typedef std::vector<named_digest::pointer> digests_t;
+
+    /**
+      * The destructor.
+      */
+    ~input_filter_message_multi() override = default;
+
+private:
+    /**
+      * The constructor.  It is private on purpose, use the #create
+      * class method instead.
+      *
+      * @param deeper
+      *     The source of data to be filtered.
+      * @param address
+      *     Where to place the first result in memory.
+      * @param digests
+      *     The checksums and message digests to work out, in the order
+      *     their results are to be placed.
+      */
+    input_filter_message_multi(const input::pointer &deeper,
+        uint32_t address, const digests_t &digests);
+
+public:
+    /**
+      * The create class method is used to create a new dynamically
+      * allocated instance of this class.  It is a fatal error if the
+      * results will not fit in a single record.
+      *
+      * @param deeper
+      *     The source of data to be filtered.
+      * @param address
+      *     Where to place the first result in memory.
+      * @param digests
+      *     The checksums and message digests to work out, in the order
+      *     their results are to be placed.
+      */
+    static pointer create(const input::pointer &deeper, uint32_t address,
+        const digests_t &digests);
+
+protected:
+    // See base class for documentation.
+    memory_walker::pointer create_walker() override;
+
+    // See base class for documentation.
+    void get_result(record &output) override;
+
+    // See base class for documentation.
+    const char *get_algorithm_name() const override;
+
+private:
+    /**
+      * The address instance variable is used to remember where to place
+      * the first result in memory.
+      */
+    uint32_t address;
+
+    /**
+      * The digests instance variable is used to remember the checksums
+      * and message digests to work out.
+      */
+    digests_t digests;
+
+    /**
+      * The algorithm_name instance variable is used to remember the
+      * names of all of the digests, for warning messages.
+      */
+    std::string algorithm_name;
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    input_filter_message_multi() = delete;
+
+    /**
+      * The copy constructor.  Do not use.
+      */
+    input_filter_message_multi(const input_filter_message_multi &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    input_filter_message_multi &operator=(
+        const input_filter_message_multi &) = delete;
+};
+
+};
+
+#endif // SRECORD_INPUT_FILTER_MESSAGE_MULTI_H
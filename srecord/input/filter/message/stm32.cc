@@ -27,7 +27,6 @@
 
 #include <srecord/arglex/tool.h>
 #include <srecord/input/filter/message/stm32.h>
-#include <srecord/memory/walker/stm32.h>
 #include <srecord/record.h>
 
 
@@ -61,20 +60,25 @@ srecord::input_filter_message_stm32::command_line(arglex_tool *)
 }
 
 
-void
-srecord::input_filter_message_stm32::process(const memory &input,
-    record &output)
+srecord::memory_walker::pointer
+srecord::input_filter_message_stm32::create_walker()
 {
     //
     // Now STM32 the bytes in order from lowest address to highest.
-    // (Holes are ignored, not filled, warning already issued.)
+    // (Holes are ignored, not filled, a warning is issued.)
     //
-    memory_walker_stm32::pointer w = memory_walker_stm32::create();
-    input.walk(w);
-    uint32_t crc = w->get();
+    walker = memory_walker_stm32::create();
+    return walker;
+}
+
+
+void
+srecord::input_filter_message_stm32::get_result(record &output)
+{
+    uint32_t crc = walker->get();
 
     //
-    // Turn the CRC into the first data record.
+    // Turn the CRC into a data record.
     //
     uint8_t chunk[4];
     record::encode(chunk, crc, sizeof(chunk), end);
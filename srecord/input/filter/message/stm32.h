@@ -31,6 +31,7 @@
 #include <srecord/stm32.h>
 #include <srecord/endian.h>
 #include <srecord/input/filter/message.h>
+#include <srecord/memory/walker/stm32.h>
 
 namespace srecord
 {
@@ -83,7 +84,10 @@ class input_filter_message_stm32:
     void command_line(arglex_tool *cmdln) override;
 
     // See base class for documentation.
-    void process(const memory &input, record &output) override;
+    memory_walker::pointer create_walker() override;
+
+    // See base class for documentation.
+    void get_result(record &output) override;
 
     // See base class for documentation.
     const char *get_algorithm_name() const override;
@@ -104,6 +108,12 @@ class input_filter_message_stm32:
       */
     endian_t end;
 
+    /**
+      * The walker instance variable is used to remember the walker
+      * working out the checksum, as made by #create_walker.
+      */
+    memory_walker_stm32::pointer walker;
+
 public:
     /**
       * The default constructor.
@@ -18,7 +18,9 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <srecord/byte_transform.h>
 #include <srecord/input/filter/nibble_swap.h>
+#include <srecord/input/filter/fused.h>
 #include <srecord/record.h>
 
 
@@ -45,10 +47,20 @@ srecord::input_filter_nibble_swap::read(srecord::record &record)
         return false;
     if (record.get_type() == srecord::record::type_data)
     {
-        for (size_t j = 0; j < record.get_length(); ++j) {
-            uint8_t tmp = record.get_data(j);
-            record.set_data(j, ((tmp & 0x0F) << 4) | ((tmp & 0xF0) >> 4));
-        }
+        byte_transform_nibble_swap(record.get_data(), record.get_length());
     }
     return true;
 }
+
+
+bool
+srecord::input_filter_nibble_swap::fuse_into(input_filter_fused &stage)
+    const
+{
+    record::data_t table[256];
+    for (unsigned j = 0; j < 256; ++j)
+        table[j] = j;
+    byte_transform_nibble_swap(table, sizeof(table));
+    stage.fuse_map("nibble swap", table);
+    return true;
+}
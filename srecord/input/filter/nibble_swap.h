@@ -57,6 +57,9 @@ class input_filter_nibble_swap:
       */
     static pointer create(const input::pointer &deeper);
 
+    // See base class for documentation.
+    bool fuse_into(input_filter_fused &stage) const override;
+
 protected:
     // See base class for documentation.
     bool read(record &record) override;
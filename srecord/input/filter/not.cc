@@ -18,7 +18,9 @@
 //
 
 
+#include <srecord/byte_transform.h>
 #include <srecord/input/filter/not.h>
+#include <srecord/input/filter/fused.h>
 #include <srecord/record.h>
 
 
@@ -42,8 +44,20 @@ srecord::input_filter_not::read(srecord::record &record)
         return false;
     if (record.get_type() == srecord::record::type_data)
     {
-        for (size_t j = 0; j < record.get_length(); ++j)
-            record.set_data(j, ~record.get_data(j));
+        byte_transform_not(record.get_data(), record.get_length());
     }
     return true;
 }
+
+
+bool
+srecord::input_filter_not::fuse_into(input_filter_fused &stage)
+    const
+{
+    record::data_t table[256];
+    for (unsigned j = 0; j < 256; ++j)
+        table[j] = j;
+    byte_transform_not(table, sizeof(table));
+    stage.fuse_map("not", table);
+    return true;
+}
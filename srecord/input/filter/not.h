@@ -57,6 +57,9 @@ class input_filter_not:
       */
     static pointer create(const input::pointer &deeper);
 
+    // See base class for documentation.
+    bool fuse_into(input_filter_fused &stage) const override;
+
 protected:
     // See base class for documentation.
     bool read(record &record) override;
@@ -18,6 +18,7 @@
 //
 
 #include <srecord/input/filter/offset.h>
+#include <srecord/input/filter/fused.h>
 #include <srecord/record.h>
 
 
@@ -55,3 +56,12 @@ srecord::input_filter_offset::read(srecord::record &record)
     record.set_address(addr);
     return true;
 }
+
+
+bool
+srecord::input_filter_offset::fuse_into(input_filter_fused &stage)
+    const
+{
+    stage.fuse_offset((uint32_t)nbytes);
+    return true;
+}
@@ -64,6 +64,9 @@ class input_filter_offset:
       */
     static pointer create(const input::pointer &deeper, long nbytes);
 
+    // See base class for documentation.
+    bool fuse_into(input_filter_fused &stage) const override;
+
 protected:
     // See base class for documentation.
     bool read(record &record) override;
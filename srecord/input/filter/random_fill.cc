@@ -42,28 +42,41 @@ srecord::input_filter_random_fill::create(const input::pointer &a_deeper,
 bool
 srecord::input_filter_random_fill::generate(srecord::record &record)
 {
-    if (range.empty())
-        return false;
+    if (!generating)
+    {
+        range.get_runs(runs);
+        run_index = 0;
+        remaining = 0;
+        generating = true;
+    }
+    while (remaining == 0)
+    {
+        if (run_index >= runs.size())
+            return false;
+        cursor = runs[run_index];
+        interval::long_data_t hi = runs[run_index + 1];
+        if (hi == 0)
+            hi = (interval::long_data_t)1 << 32;
+        remaining = hi - cursor;
+        run_index += 2;
+    }
+
     uint8_t buffer[srecord::record::max_data_length];
-    interval::data_t lo = range.get_lowest();
-    interval::data_t hi = lo + sizeof(buffer);
-    if (hi < lo)
-        hi = 0;
-    interval chunk(lo, hi);
-    chunk *= range;
-    chunk.first_interval_only();
-    int nbytes = chunk.get_highest() - chunk.get_lowest();
-    for (int j = 0; j < nbytes; ++j)
+    size_t nbytes = sizeof(buffer);
+    if (nbytes > remaining)
+        nbytes = remaining;
+    for (size_t j = 0; j < nbytes; ++j)
         buffer[j] = r250();
     record =
         srecord::record
         (
             srecord::record::type_data,
-            chunk.get_lowest(),
+            cursor,
             buffer,
             nbytes
         );
-    range -= chunk;
+    cursor += nbytes;
+    remaining -= nbytes;
     return true;
 }
 
@@ -20,6 +20,8 @@
 #ifndef SRECORD_INPUT_FILTER_RANDOM_FILL_H
 #define SRECORD_INPUT_FILTER_RANDOM_FILL_H
 
+#include <vector>
+
 #include <srecord/interval.h>
 #include <srecord/input/filter.h>
 #include <srecord/record.h>
@@ -71,11 +73,43 @@ class input_filter_random_fill:
 private:
     /**
       * The range instance variable is used to remember the range of
-      * addresses to be filled.  As fill blocks are produced the range
-      * is reduced.
+      * addresses to be filled.  As data records are read, their
+      * addresses are removed from the range.
       */
     interval range;
 
+    /**
+      * The runs instance variable is used to remember the [lo, hi)
+      * pairs of the range, once the deeper input is exhausted and fill
+      * records are being generated.
+      */
+    std::vector<interval::data_t> runs;
+
+    /**
+      * The run_index instance variable is used to remember the index,
+      * within #runs, of the next run to be filled.
+      */
+    size_t run_index{0};
+
+    /**
+      * The cursor instance variable is used to remember the address of
+      * the next fill record.
+      */
+    interval::data_t cursor{0};
+
+    /**
+      * The remaining instance variable is used to remember how many
+      * bytes of the current run are still to be filled.
+      */
+    interval::long_data_t remaining{0};
+
+    /**
+      * The generating instance variable is used to remember whether or
+      * not the deeper input has been exhausted, and fill generation
+      * has begun.
+      */
+    bool generating{false};
+
     /**
       * The generate method is used to generate fill records.
       */
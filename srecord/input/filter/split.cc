@@ -17,6 +17,8 @@
 // <http://www.gnu.org/licenses/>.
 //
 
+#include <cstring>
+
 #include <srecord/input/filter/split.h>
 #include <srecord/record.h>
 
@@ -66,12 +68,27 @@ srecord::input_filter_split::read(srecord::record &record)
             buffer_pos = 0;
         }
 
-        srecord::record::address_t addr =
-            (buffer.get_address() + offset + buffer_pos);
-        srecord::record::address_t phase = addr % modulus;
-        if (phase < width)
+        //
+        // The bytes kept from consecutive modulus-sized blocks land
+        // next to each other in the output, so gather as many as map
+        // onto contiguous addresses into a single record.
+        //
+        uint8_t data[srecord::record::max_data_length];
+        size_t nbytes = 0;
+        srecord::record::address_t start = 0;
+        while (buffer_pos < buffer.get_length())
         {
-            uint8_t c = buffer.get_data(buffer_pos++);
+            srecord::record::address_t addr =
+                (buffer.get_address() + offset + buffer_pos);
+            srecord::record::address_t phase = addr % modulus;
+            size_t avail = buffer.get_length() - buffer_pos;
+            if (phase >= width)
+            {
+                size_t skip = modulus - phase;
+                buffer_pos += (skip < avail ? skip : avail);
+                continue;
+            }
+
             //
             // Because the offset was made positive by
             // subtracting it from the modulus (to avoid
@@ -81,9 +98,28 @@ srecord::input_filter_split::read(srecord::record &record)
             // off before the width multiplication.
             //
             addr = (addr / modulus - 1) * width + phase;
-            record = srecord::record(srecord::record::type_data, addr, &c, 1);
+            if (nbytes && addr != start + nbytes)
+                break;
+            if (!nbytes)
+                start = addr;
+            size_t len = width - phase;
+            if (len > avail)
+                len = avail;
+            memcpy(data + nbytes, buffer.get_data() + buffer_pos, len);
+            nbytes += len;
+            buffer_pos += len;
+        }
+        if (nbytes)
+        {
+            record =
+                srecord::record
+                (
+                    srecord::record::type_data,
+                    start,
+                    data,
+                    nbytes
+                );
             return true;
         }
-        ++buffer_pos;
     }
 }
@@ -18,8 +18,68 @@
 //
 
 
+#include <cstring>
+
 #include <srecord/input/filter/unfill.h>
 
+#if defined(__GNUC__) && defined(__SSE2__)
+#define SRECORD_UNFILL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+
+/**
+  * The find_value function is used to find the first byte equal to the
+  * given value.  The C library's memchr is already vectorised.
+  *
+  * @returns
+  *     the offset of the byte, or len if there is none
+  */
+static size_t
+find_value(const uint8_t *data, size_t len, uint8_t value)
+{
+    const void *p = memchr(data, value, len);
+    return (p ? (const uint8_t *)p - data : len);
+}
+
+
+/**
+  * The skip_value function is used to find the first byte which is
+  * not equal to the given value; the length of the run of that value at
+  * the start of the data.
+  *
+  * @returns
+  *     the offset of the byte, or len if there is none
+  */
+static size_t
+skip_value(const uint8_t *data, size_t len, uint8_t value)
+{
+    size_t j = 0;
+#ifdef SRECORD_UNFILL_SSE2
+    const __m128i v = _mm_set1_epi8((char)value);
+    for (; j + 16 <= len; j += 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)(data + j));
+        unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(x, v)) ^ 0xFFFFu;
+        if (mask)
+            return j + __builtin_ctz(mask);
+    }
+#else
+    const uint64_t v = 0x0101010101010101ull * value;
+    for (; j + 8 <= len; j += 8)
+    {
+        uint64_t x;
+        memcpy(&x, data + j, sizeof(x));
+        if (x != v)
+            break;
+    }
+#endif
+    while (j < len && data[j] == value)
+        ++j;
+    return j;
+}
+
+
 srecord::input_filter_unfill::input_filter_unfill(
         const srecord::input::pointer &a1, int a2, int a3) :
     srecord::input_filter(a1),
@@ -59,56 +119,48 @@ srecord::input_filter_unfill::read(srecord::record &record)
             buffer_pos = 0;
         }
 
-        int first_pos = buffer_pos;
-        uint32_t addr = buffer.get_address() + buffer_pos;
-        uint8_t c = buffer.get_data(buffer_pos++);
-        if (c == fill_value)
+        //
+        // Gather the longest span we can of non-fill bytes, along with
+        // any runs of fill bytes shorter than the minimum.  This is so
+        // that single bytes can be left in, but long patches are thrown
+        // away.  Runs are not counted across record boundaries.
+        //
+        const record::data_t *data = buffer.get_data();
+        size_t length = buffer.get_length();
+        size_t first_pos = buffer_pos;
+        size_t end_pos = buffer_pos;
+        while (buffer_pos < length)
         {
-            //
-            // Let runs of fill characters go through,
-            // if the run is shorter than the minimum.
-            // This is so that single bytes can be left in,
-            // but long patches are thrown away.
-            //
-            while (buffer_pos < buffer.get_length())
+            size_t run_end =
+                buffer_pos +
+                skip_value(data + buffer_pos, length - buffer_pos, fill_value);
+            if (run_end > buffer_pos)
             {
-                c = buffer.get_data(buffer_pos);
-                if (c != fill_value)
-                    break;
-                ++buffer_pos;
-            }
-            if (buffer_pos - first_pos < fill_minimum)
-            {
-                record =
-                    srecord::record
-                    (
-                        srecord::record::type_data,
-                        addr,
-                        buffer.get_data() + first_pos,
-                        buffer_pos - first_pos
-                    );
-                return true;
+                if (run_end - buffer_pos >= fill_minimum)
+                {
+                    buffer_pos = run_end;
+                    if (end_pos > first_pos)
+                        break;
+                    first_pos = end_pos = buffer_pos;
+                    continue;
+                }
+                buffer_pos = run_end;
+                end_pos = run_end;
+                continue;
             }
+            buffer_pos +=
+                find_value(data + buffer_pos, length - buffer_pos, fill_value);
+            end_pos = buffer_pos;
         }
-        else
+        if (end_pos > first_pos)
         {
-            //
-            // Let runs of non-fill characters go straight through.
-            //
-            while (buffer_pos < buffer.get_length())
-            {
-                c = buffer.get_data(buffer_pos);
-                if (c == fill_value)
-                    break;
-                ++buffer_pos;
-            }
             record =
                 srecord::record
                 (
                     srecord::record::type_data,
-                    addr,
-                    buffer.get_data() + first_pos,
-                    buffer_pos - first_pos
+                    buffer.get_address() + first_pos,
+                    data + first_pos,
+                    end_pos - first_pos
                 );
             return true;
         }
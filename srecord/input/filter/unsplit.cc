@@ -60,11 +60,27 @@ srecord::input_filter_unsplit::read(srecord::record &record)
             buffer_pos = 0;
         }
 
+        //
+        // Each width-sized group of bytes lands contiguously in the
+        // output, with a gap before the next group (unless the
+        // modulus and width are the same), so pass on a group (or
+        // what remains of it) at a time.
+        //
         uint32_t addr = buffer.get_address() + buffer_pos;
-        uint8_t c = buffer.get_data(buffer_pos++);
-        int phase = addr % width;
+        uint32_t phase = addr % width;
+        size_t nbytes = buffer.get_length() - buffer_pos;
+        if (modulus != width && nbytes > width - phase)
+            nbytes = width - phase;
         addr = (addr / width) * modulus + phase + offset;
-        record = srecord::record(srecord::record::type_data, addr, &c, 1);
+        record =
+            srecord::record
+            (
+                srecord::record::type_data,
+                addr,
+                buffer.get_data() + buffer_pos,
+                nbytes
+            );
+        buffer_pos += nbytes;
         return true;
     }
 }
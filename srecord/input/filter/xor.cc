@@ -17,7 +17,11 @@
 // <http://www.gnu.org/licenses/>.
 //
 
+#include <cstdio>
+
+#include <srecord/byte_transform.h>
 #include <srecord/input/filter/xor.h>
+#include <srecord/input/filter/fused.h>
 #include <srecord/record.h>
 
 
@@ -43,8 +47,22 @@ srecord::input_filter_xor::read(srecord::record &record)
         return false;
     if (record.get_type() == srecord::record::type_data)
     {
-        for (size_t j = 0; j < record.get_length(); ++j)
-            record.set_data(j, record.get_data(j) ^ value);
+        byte_transform_xor(record.get_data(), record.get_length(), value);
     }
     return true;
 }
+
+
+bool
+srecord::input_filter_xor::fuse_into(input_filter_fused &stage)
+    const
+{
+    record::data_t table[256];
+    for (unsigned j = 0; j < 256; ++j)
+        table[j] = j;
+    byte_transform_xor(table, sizeof(table), value);
+    char name[16];
+    snprintf(name, sizeof(name), "xor 0x%02X", value);
+    stage.fuse_map(name, table);
+    return true;
+}
@@ -62,6 +62,9 @@ class input_filter_xor:
       */
     static pointer create(const input::pointer &deeper, int value);
 
+    // See base class for documentation.
+    bool fuse_into(input_filter_fused &stage) const override;
+
 protected:
     // See base class for documentation.
     bool read(record &record) override;
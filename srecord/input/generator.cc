@@ -36,46 +36,46 @@ srecord::input_generator::input_generator(const interval &a_range) :
 bool
 srecord::input_generator::read(srecord::record &result)
 {
+    if (!generating)
+    {
+        range.get_runs(runs);
+        run_index = 0;
+        remaining = 0;
+        generating = true;
+    }
+
     //
     // If there is not data left to generate,
     // signal end-of-file
     //
-    if (range.empty())
-        return false;
-
-    //
-    // Calculate the address range for this chunk of data.  Use the
-    // biggest record size available.
-    //
-    interval::data_t addr = range.get_lowest();
-    interval::data_t end  = addr + srecord::record::max_data_length;
-    if (end < addr)
-        end = 0;
-    interval partial(addr, end);
-    partial *= range;
-
-    //
-    // Only supply the first sub-interval, if the generation range has
-    // holes in it.
-    //
-    partial.first_interval_only();
+    while (remaining == 0)
+    {
+        if (run_index >= runs.size())
+            return false;
+        cursor = runs[run_index];
+        interval::long_data_t hi = runs[run_index + 1];
+        if (hi == 0)
+            hi = (interval::long_data_t)1 << 32;
+        remaining = hi - cursor;
+        run_index += 2;
+    }
 
     //
-    // Generate the data and build the result record.
+    // Generate the data and build the result record.  Use the biggest
+    // record size available.
     //
-    result.set_type(srecord::record::type_data);
-    result.set_address(addr);
-    result.set_length(1);
-    interval::data_t size = partial.get_highest() - addr;
-    for (interval::data_t j = 0; j < size; ++j)
-    {
-        result.set_data_extend(j, generate_data(addr + j));
-    }
+    uint8_t buffer[srecord::record::max_data_length];
+    size_t size = sizeof(buffer);
+    if (size > remaining)
+        size = remaining;
+    generate_block(cursor, buffer, size);
+    result = srecord::record(srecord::record::type_data, cursor, buffer, size);
 
     //
     // Reduce the amount of data left to be generated.
     //
-    range -= partial;
+    cursor += size;
+    remaining -= size;
 
     //
     // Report that another record is available.
@@ -84,6 +84,15 @@ srecord::input_generator::read(srecord::record &result)
 }
 
 
+void
+srecord::input_generator::generate_block(uint32_t address, uint8_t *data,
+    size_t nbytes)
+{
+    for (size_t j = 0; j < nbytes; ++j)
+        data[j] = generate_data(address + j);
+}
+
+
 srecord::input::pointer
 srecord::input_generator::create(srecord::arglex_tool *cmdln)
 {
@@ -20,6 +20,8 @@
 #ifndef SRECORD_INPUT_GENERATOR_H
 #define SRECORD_INPUT_GENERATOR_H
 
+#include <vector>
+
 #include <srecord/input.h>
 #include <srecord/interval.h>
 
@@ -74,14 +76,59 @@ class input_generator:
       */
     virtual uint8_t generate_data(uint32_t address) = 0;
 
+    /**
+      * The generate_block method is used to manufacture data for a run
+      * of adjacent addresses.  The default implementation calls
+      * #generate_data once per byte; derived classes should override it
+      * when they can do better.
+      *
+      * @param address
+      *     The address of the first byte to generate data for.
+      * @param data
+      *     Where to put the generated data.
+      * @param nbytes
+      *     The number of bytes to generate.
+      */
+    virtual void generate_block(uint32_t address, uint8_t *data,
+        size_t nbytes);
+
 private:
     /**
       * The range instance variable is used to remember the address
-      * range over which we are to generate data.  It shrinks as the
-      * data is generated.
+      * range over which we are to generate data.
       */
     interval range;
 
+    /**
+      * The runs instance variable is used to remember the [lo, hi)
+      * pairs of the range, once generation has started.
+      */
+    std::vector<interval::data_t> runs;
+
+    /**
+      * The run_index instance variable is used to remember the index,
+      * within #runs, of the next run to be generated.
+      */
+    size_t run_index{0};
+
+    /**
+      * The cursor instance variable is used to remember the address of
+      * the next record to be generated.
+      */
+    interval::data_t cursor{0};
+
+    /**
+      * The remaining instance variable is used to remember how many
+      * bytes of the current run are still to be generated.
+      */
+    interval::long_data_t remaining{0};
+
+    /**
+      * The generating instance variable is used to remember whether or
+      * not the #runs have been filled in yet.
+      */
+    bool generating{false};
+
 public:
     /**
       * The default constructor.
@@ -18,6 +18,7 @@
 //
 
 #include <cstdio>
+#include <cstring>
 
 #include <srecord/input/generator/constant.h>
 
@@ -44,6 +45,14 @@ srecord::input_generator_constant::generate_data(uint32_t)
 }
 
 
+void
+srecord::input_generator_constant::generate_block(uint32_t, uint8_t *data,
+    size_t nbytes)
+{
+    memset(data, datum, nbytes);
+}
+
+
 std::string
 srecord::input_generator_constant::filename()
     const
@@ -42,6 +42,35 @@ srecord::input_generator_random::generate_data(uint32_t)
 }
 
 
+void
+srecord::input_generator_random::generate_block(uint32_t, uint8_t *data,
+    size_t nbytes)
+{
+    //
+    // Use all four bytes of each random number.
+    //
+    while (nbytes >= 4)
+    {
+        uint32_t n = r250();
+        data[0] = n;
+        data[1] = n >> 8;
+        data[2] = n >> 16;
+        data[3] = n >> 24;
+        data += 4;
+        nbytes -= 4;
+    }
+    if (nbytes)
+    {
+        uint32_t n = r250();
+        while (nbytes--)
+        {
+            *data++ = n;
+            n >>= 8;
+        }
+    }
+}
+
+
 std::string
 srecord::input_generator_random::filename()
     const
@@ -17,6 +17,8 @@
 // <http://www.gnu.org/licenses/>.
 //
 
+#include <cstring>
+
 #include <srecord/input/generator/repeat.h>
 
 
@@ -56,6 +58,39 @@ srecord::input_generator_repeat::generate_data(uint32_t addr)
 }
 
 
+void
+srecord::input_generator_repeat::generate_block(uint32_t addr, uint8_t *buf,
+    size_t nbytes)
+{
+    //
+    // The first piece runs from the middle of the pattern to its end.
+    //
+    size_t offset = (addr - address) % length;
+    size_t head = length - offset;
+    if (head >= nbytes)
+    {
+        memcpy(buf, data + offset, nbytes);
+        return;
+    }
+    memcpy(buf, data + offset, head);
+    buf += head;
+    nbytes -= head;
+
+    //
+    // After that it's whole patterns, so keep doubling what has
+    // already been written.
+    //
+    size_t done = (length < nbytes ? length : nbytes);
+    memcpy(buf, data, done);
+    while (done < nbytes)
+    {
+        size_t n = (done < nbytes - done ? done : nbytes - done);
+        memcpy(buf + done, buf, n);
+        done += n;
+    }
+}
+
+
 std::string
 srecord::input_generator_repeat::filename()
     const
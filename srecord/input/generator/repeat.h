@@ -71,6 +71,10 @@ class input_generator_repeat:
     // See base class for documentation.
     uint8_t generate_data(uint32_t address) override;
 
+    // See base class for documentation.
+    void generate_block(uint32_t address, uint8_t *data, size_t nbytes)
+        override;
+
     // See base class for documentation.
     std::string filename() const override;
 
@@ -19,6 +19,7 @@
 
 #include <srecord/interval.h>
 #include <srecord/input.h>
+#include <srecord/input/cache.h>
 #include <srecord/input/interval.h>
 #include <srecord/record.h>
 
@@ -27,6 +28,14 @@ srecord::interval
 srecord::input_interval(srecord::input::pointer ifp)
 {
     interval range;
+
+    //
+    // A file which has already been parsed knows its range.
+    //
+    auto cp = std::dynamic_pointer_cast<input_cache>(ifp);
+    if (cp && cp->get_range(range))
+        return range;
+
     srecord::record record;
     while (ifp->read(record))
     {
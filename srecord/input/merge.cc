@@ -0,0 +1,140 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <algorithm>
+#include <cassert>
+
+#include <srecord/input/merge.h>
+
+
+srecord::input_merge::input_merge(const std::vector<pointer> &a_inputs)
+{
+    assert(!a_inputs.empty());
+    sources.resize(a_inputs.size());
+    heap.reserve(a_inputs.size());
+    refill.reserve(a_inputs.size());
+    for (size_t j = 0; j < a_inputs.size(); ++j)
+    {
+        assert(!!a_inputs[j]);
+        sources[j].ip = a_inputs[j];
+        refill.push_back(a_inputs.size() - 1 - j);
+    }
+}
+
+
+srecord::input::pointer
+srecord::input_merge::create(const std::vector<pointer> &a_inputs)
+{
+    return pointer(new input_merge(a_inputs));
+}
+
+
+bool
+srecord::input_merge::later(size_t a, size_t b)
+    const
+{
+    record::address_t aa = sources[a].next.get_address();
+    record::address_t ba = sources[b].next.get_address();
+    return (aa != ba ? aa > ba : a > b);
+}
+
+
+bool
+srecord::input_merge::read(record &result)
+{
+    auto cmp = [this](size_t a, size_t b) { return later(a, b); };
+
+    //
+    // Read the next data record of each source which needs one.
+    // Anything else they have to say along the way is passed straight
+    // through.
+    //
+    while (!refill.empty())
+    {
+        size_t j = refill.back();
+        source &s = sources[j];
+        current = j;
+        if (!s.ip->read(s.next))
+        {
+            refill.pop_back();
+            continue;
+        }
+        switch (s.next.get_type())
+        {
+        case record::type_unknown:
+        case record::type_data_count:
+            continue;
+
+        case record::type_data:
+            refill.pop_back();
+            heap.push_back(j);
+            std::push_heap(heap.begin(), heap.end(), cmp);
+            continue;
+
+        default:
+            result = s.next;
+            return true;
+        }
+    }
+
+    //
+    // Hand out the lowest addressed data record.
+    //
+    if (heap.empty())
+        return false;
+    std::pop_heap(heap.begin(), heap.end(), cmp);
+    size_t j = heap.back();
+    heap.pop_back();
+    current = j;
+    result = sources[j].next;
+    refill.push_back(j);
+    return true;
+}
+
+
+std::string
+srecord::input_merge::filename()
+    const
+{
+    return sources[current].ip->filename();
+}
+
+
+std::string
+srecord::input_merge::filename_and_line()
+    const
+{
+    return sources[current].ip->filename_and_line();
+}
+
+
+const char *
+srecord::input_merge::get_file_format_name()
+    const
+{
+    return sources[current].ip->get_file_format_name();
+}
+
+
+void
+srecord::input_merge::disable_checksum_validation()
+{
+    for (source &s : sources)
+        s.ip->disable_checksum_validation();
+}
@@ -0,0 +1,152 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_INPUT_MERGE_H
+#define SRECORD_INPUT_MERGE_H
+
+#include <vector>
+
+#include <srecord/input.h>
+#include <srecord/record.h>
+
+namespace srecord {
+
+/**
+  * The srecord::input_merge class is used to represent an input source
+  * which presents several input sources as a single input source, with
+  * the data records of all of them in ascending address order.
+  *
+  * Each input is expected to be in ascending address order already
+  * (most files are, see the -Enable_Sequence_Warnings option); the
+  * next data record of each input is held in a min-heap, so each record
+  * costs O(log k) for k inputs.  Where inputs have data at the same
+  * address, the earlier input on the command line goes first.  Records
+  * which are not data (headers, execution start addresses) are passed
+  * through as they are encountered.
+  */
+class input_merge:
+    public input
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~input_merge() override = default;
+
+private:
+    /**
+      * The constructor.
+      * It is private on purpose, use the #create class method instead.
+      *
+      * @param inputs
+      *     The inputs to be merged.
+      */
+    input_merge(const std::vector<pointer> &inputs);
+
+public:
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      *
+      * @param inputs
+      *     The inputs to be merged.  There must be at least one.
+      */
+    static pointer create(const std::vector<pointer> &inputs);
+
+protected:
+    // See base class for documentation.
+    bool read(record &record) override;
+
+    // See base class for documentation.
+    std::string filename() const override;
+
+    // See base class for documentation.
+    std::string filename_and_line() const override;
+
+    // See base class for documentation.
+    const char *get_file_format_name() const override;
+
+    // See base class for documentation.
+    void disable_checksum_validation() override;
+
+private:
+    /**
+      * The source class is used to remember an input and its next
+      * data record.
+      */
+    struct source
+    {
+        /** The input to be read. */
+        pointer ip;
+
+        /** The next record read from the input. */
+        record next;
+    };
+
+    /**
+      * The sources instance variable is used to remember the inputs
+      * being merged, in command line order.
+      */
+    std::vector<source> sources;
+
+    /**
+      * The heap instance variable is used to remember the indexes of
+      * the sources holding a next data record, as a min-heap ordered
+      * by address, then by index.
+      */
+    std::vector<size_t> heap;
+
+    /**
+      * The refill instance variable is used to remember the indexes of
+      * the sources which need their next data record read, last first.
+      */
+    std::vector<size_t> refill;
+
+    /**
+      * The current instance variable is used to remember the index of
+      * the source the most recent record came from, for error messages.
+      */
+    size_t current{0};
+
+    /**
+      * The later method is used to order the heap: it returns true if
+      * source a's next record comes after source b's.
+      */
+    bool later(size_t a, size_t b) const;
+
+public:
+    /**
+      * The default constructor.
+      */
+    input_merge() = delete;
+
+    /**
+      * The copy constructor.
+      */
+    input_merge(const input_merge &) = delete;
+
+    /**
+      * The assignment operator.
+      */
+    input_merge &operator=(const input_merge &) = delete;
+};
+
+};
+
+#endif // SRECORD_INPUT_MERGE_H
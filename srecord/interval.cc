@@ -17,36 +17,23 @@
 // <http://www.gnu.org/licenses/>.
 //
 
+#include <algorithm>
 #include <cstdio>
 #include <iostream>
+#include <iterator>
 
 #include <srecord/interval.h>
 
 
 //
-// NAME
-//      interval_create_empty - create an empty interval
-//
-// SYNOPSIS
-//      interval_ty *interval_create_empty(void);
-//
-// DESCRIPTION
-//      The interval_create_empty function is used to create
-//      an empty interval.
-//
-// RETURNS
-//      a pointer to the new interval in dynamic memory
-//
-// CAVEAT
-//      It is the responsibility of the caller to release the
-//      interval to dynamic memory when no longer required.
-//      Use the interval_free function for this purpose.
+// An upper bound of zero means 2**32, so that the whole address space
+// can be described using 32-bit values.
 //
 
 static inline srecord::interval::long_data_t
-promote(srecord::interval::data_t datum, size_t pos)
+promote(srecord::interval::data_t datum)
 {
-    if (datum == 0 && (pos & 1))
+    if (datum == 0)
         return ((srecord::interval::long_data_t)1 << 32);
     return datum;
 }
@@ -62,72 +49,30 @@ promote(srecord::interval::data_t datum, size_t pos)
 //
 // DESCRIPTION
 //      The interval_create_range function is used to create an interval
-//      consisting of a single range, from first to last inclusive.
-//
-// ARGUMENTS
-//      first   - the start of the range
-//      last    - the end of the range (inclusive)
-//
-// RETURNS
-//      a pointer to the new interval in dynamic memory
-//
-// CAVEAT
-//      It is the responsibility of the caller to release the
-//      interval to dynamic memory when no longer required.
-//      Use the interval_free function for this purpose.
+//      consisting of a single range, from first to last exclusive.
+//      If they are the wrong way round, they are swapped.
 //
 
 srecord::interval::interval(data_t first, data_t last)
 {
-    length = 2;
-    size = 8;
-    data = new data_t[size + 1];
-    scan_index = 0;
-    scan_next_datum = 0;
-    if (first <= promote(last, 1))
-    {
-        data[0] = first;
-        data[1] = last;
-    }
+    if (first <= promote(last))
+        insert_run(first, promote(last));
     else
-    {
-        data[0] = last;
-        data[1] = first;
-    }
-    data[2] = 2;
+        insert_run(last, first);
     // assert(valid());
 }
 
 
 srecord::interval::interval(data_t first)
 {
-    length = 2;
-    size = 8;
-    data = new data_t[size + 1];
-    scan_index = 0;
-    scan_next_datum = 0;
-    data[0] = first;
-    data[1] = first + 1;
-    data[2] = 2;
+    insert_run(first, (long_data_t)first + 1);
     // assert(valid());
 }
 
 
-srecord::interval::interval(const interval &arg)
+srecord::interval::interval(const interval &arg) :
+    runs(arg.runs)
 {
-    // assert(arg.valid());
-    length = arg.length;
-    size = length;
-    scan_index = 0;
-    scan_next_datum = 0;
-    if (size)
-    {
-        data = new data_t[size + 1];
-        for (size_t j = 0; j <= length; ++j)
-            data[j] = arg.data[j];
-    }
-    else
-        data = 0;
     // assert(valid());
 }
 
@@ -137,173 +82,204 @@ srecord::interval::operator=(const interval &arg)
 {
     if (this != &arg)
     {
-        if (data)
-        {
-            delete [] data;
-            data = 0;
-        }
-        // assert(arg.valid());
-        length = arg.length;
-        size = length;
-        scan_index = 0;
+        runs = arg.runs;
+        scanning = false;
         scan_next_datum = 0;
-        if (size)
-        {
-            data = new data_t[size + 1];
-            for (size_t j = 0; j <= length; ++j)
-                data[j] = arg.data[j];
-        }
-        else
-            data = 0;
         // assert(valid());
     }
     return *this;
 }
 
 
-//
-// NAME
-//      interval_free - release interval memory
-//
-// SYNOPSIS
-//      void interval_free(interval_ty *ip);
-//
-// DESCRIPTION
-//      The interval_free function is used to release the dynamic
-//      memory used by an interval back to the dynamic memory pool.
-//
-// ARGUMENTS
-//      ip      - the interval to release
-//
-
-srecord::interval::~interval()
-{
-    // assert(valid());
-    if (data)
-    {
-        delete [] data;
-        data = 0;
-    }
-}
+srecord::interval::~interval() = default;
 
 
 //
 // NAME
 //      interval_valid - internal consistency check
 //
-// SYNOPSIS
-//      int interval_valid(interval_ty *ip);
-//
 // DESCRIPTION
 //      The interval_valid function is used to check the internal
-//      consistency of an interval.
-//
-// ARGUMENTS
-//      ip      - pointer to interval to check
-//
-// RETURNS
-//      int     1 if interval is valid
-//              0 if interval is not valid
+//      consistency of an interval: every run is non-empty, and each
+//      run starts strictly after the previous one ends (otherwise they
+//      should have been coalesced).
 //
 // CAVEAT
-//      This function is only available if DEBUG is defined,
-//      and is intended for use in assert() statements.
+//      This is intended for use in assert() statements.
 //
 
 bool
 srecord::interval::valid()
     const
 {
-    if (length > size)
-        return false;
-    if (length & 1)
-        return false;
-    if ((size == 0) != (data == 0))
-        return false;
-    if (length == 0)
-        return true;
-    if (data[length] != length)
-        return false;
-
-    //
-    // As a special case, an upper bound of zero means
-    // positive infinity.  It has to be the last one.
-    //
-    size_t max = length;
-    if (data[max - 1] == 0)
-        --max;
-
-    for (size_t j = 1; j < max; ++j)
-        if (data[j - 1] >= data[j])
+    long_data_t prev_hi = 0;
+    bool first = true;
+    for (const auto &run : runs)
+    {
+        if (run.first >= run.second)
+            return false;
+        if (run.second > ((long_data_t)1 << 32))
             return false;
+        if (!first && run.first <= prev_hi)
+            return false;
+        prev_hi = run.second;
+        first = false;
+    }
     return true;
 }
 
 
-//
-// NAME
-//      append - append datum to interval data
-//
-// SYNOPSIS
-//      void append(interval_ty **ipp, interval_data_ty datum);
-//
-// DESCRIPTION
-//      The append function is used to append a datum to
-//      the end of an interval under construction.
-//
-// ARGUMENTS
-//      ipp     - pointer to interval pointer.
-//      datum   - value to append.
-//
-// CAVEAT
-//      The interval may move in dynamic memory, with is why ** is used.
-//      The interval will need to be normalized before you
-//      next use interval_valid.
-//
-
 void
-srecord::interval::append(data_t datum)
+srecord::interval::insert_run(long_data_t lo, long_data_t hi)
 {
+    if (lo >= hi)
+        return;
+
     //
-    // should always be increasing
+    // The common case is building an interval in ascending order,
+    // so check the top run first; appending or extending it does not
+    // need a search.
     //
-    // assert(length < 1 || promote(datum, length) >=
-    //  promote(data[length - 1], length - 1));
+    if (runs.empty() || lo > runs.rbegin()->second)
+    {
+        runs.emplace_hint(runs.end(), (data_t)lo, hi);
+        return;
+    }
+    auto last = std::prev(runs.end());
+    if (lo >= last->first)
+    {
+        if (hi > last->second)
+            last->second = hi;
+        return;
+    }
 
     //
-    // make it larger if necessary
+    // Absorb the run below, if it overlaps or touches,
+    // and then every run that starts within [lo, hi].
     //
-    if (length >= size)
+    auto it = runs.upper_bound((data_t)lo);
+    if (it != runs.begin())
     {
-        size = size * 2 + 8;
-        auto *tmp = new data_t[size + 1];
-        if (data)
+        auto prev = std::prev(it);
+        if (prev->second >= lo)
         {
-            for (size_t k = 0; k < length; ++k)
-                tmp[k] = data[k];
-            delete [] data;
+            if (prev->second >= hi)
+                return;
+            lo = prev->first;
+            runs.erase(prev);
         }
-        data = tmp;
     }
+    while (it != runs.end() && it->first <= hi)
+    {
+        if (it->second > hi)
+            hi = it->second;
+        it = runs.erase(it);
+    }
+    runs.emplace_hint(it, (data_t)lo, hi);
+}
 
-    //
-    // remember the datum
-    //
-    data[length++] = datum;
+
+void
+srecord::interval::erase_run(long_data_t lo, long_data_t hi)
+{
+    if (lo >= hi || runs.empty())
+        return;
 
     //
-    // elide empty sequences
+    // Trim (or split) the run which starts below lo.
     //
-    // See the comment for the "data" instance variable; it is a
-    // series of [lo, hi) pairs.
+    auto it = runs.upper_bound((data_t)lo);
+    if (it != runs.begin())
+    {
+        auto prev = std::prev(it);
+        if (prev->second > lo)
+        {
+            long_data_t prev_hi = prev->second;
+            if (prev->first == lo)
+                runs.erase(prev);
+            else
+                prev->second = lo;
+            if (prev_hi > hi)
+            {
+                runs.emplace_hint(it, (data_t)hi, prev_hi);
+                return;
+            }
+        }
+    }
+
     //
-    // There are two cases here
-    //   length is odd:   [a, b) [b, ???)  -->   [a, ???)
-    //   length is even:  [a, a)           -->   {}
-    // Either way, discard the last two elements.
+    // Remove every run which starts within [lo, hi), keeping any
+    // tail which sticks out the top.
     //
-    if (length >= 2 && data[length - 1] == data[length - 2])
-        length -= 2;
+    while (it != runs.end() && it->first < hi)
+    {
+        long_data_t it_hi = it->second;
+        it = runs.erase(it);
+        if (it_hi > hi)
+        {
+            runs.emplace_hint(it, (data_t)hi, it_hi);
+            break;
+        }
+    }
+}
+
+
+void
+srecord::interval::insert(data_t lo, data_t hi)
+{
+    insert_run(lo, promote(hi));
+    // assert(valid());
+}
+
+
+void
+srecord::interval::insert(const interval &arg)
+{
+    if (this == &arg)
+        return;
+    if (runs.empty())
+    {
+        runs = arg.runs;
+        return;
+    }
+    for (const auto &run : arg.runs)
+        insert_run(run.first, run.second);
+    // assert(valid());
+}
+
+
+void
+srecord::interval::erase(data_t lo, data_t hi)
+{
+    erase_run(lo, promote(hi));
+    // assert(valid());
+}
+
+
+void
+srecord::interval::erase(const interval &arg)
+{
+    if (this == &arg)
+    {
+        runs.clear();
+        return;
+    }
+    for (const auto &run : arg.runs)
+    {
+        if (runs.empty())
+            break;
+        erase_run(run.first, run.second);
+    }
+    // assert(valid());
+}
+
+
+void
+srecord::interval::retain(const interval &arg)
+{
+    if (this == &arg)
+        return;
+    *this = intersection(*this, arg);
 }
 
 
@@ -311,24 +287,10 @@ srecord::interval::append(data_t datum)
 // NAME
 //      interval_union - union of two intervals
 //
-// SYNOPSIS
-//      interval_ty *interval_union(interval_ty *left, interval_ty *right);
-//
 // DESCRIPTION
 //      The interval_union function is used to form the
-//      union of two intervals.
-//
-// ARGUMENTS
-//      left    - interval to form the union with
-//      right   - another interval
-//
-// RETURNS
-//      a pointer to the new interval in dynamic memory
-//
-// CAVEAT
-//      It is the responsibility of the caller to release the
-//      interval to dynamic memory when no longer required.
-//      Use the interval_free function for this purpose.
+//      union of two intervals.  The smaller is inserted
+//      into a copy of the larger.
 //
 
 srecord::interval
@@ -336,54 +298,10 @@ srecord::interval::union_(const interval &left, const interval &right)
 {
     // assert(left.valid());
     // assert(right.valid());
-    interval result;
-    size_t left_pos = 0;
-    size_t right_pos = 0;
-    int count = 0;
-    for (;;)
-    {
-        int old_count = count;
-        data_t place;
-        if (left_pos < left.length)
-        {
-            if (right_pos < right.length)
-            {
-                long_data_t left_val =
-                    promote(left.data[left_pos], left_pos);
-                long_data_t right_val =
-                    promote(right.data[right_pos], right_pos);
-                if (left_val < right_val)
-                {
-                    count += (left_pos & 1 ? -1 : 1);
-                    place = left.data[left_pos++];
-                }
-                else
-                {
-                    count += (right_pos & 1 ? -1 : 1);
-                    place = right.data[right_pos++];
-                }
-            }
-            else
-            {
-                count += (left_pos & 1 ? -1 : 1);
-                place = left.data[left_pos++];
-            }
-        }
-        else
-        {
-            if (right_pos < right.length)
-            {
-                count += (right_pos & 1 ? -1 : 1);
-                place = right.data[right_pos++];
-            }
-            else
-                break;
-        }
-        if ((count >= 1) != (old_count >= 1))
-            result.append(place);
-    }
-    if (result.length)
-        result.data[result.length] = result.length;
+    if (left.runs.size() < right.runs.size())
+        return union_(right, left);
+    interval result(left);
+    result.insert(right);
     // assert(result.valid());
     return result;
 }
@@ -393,25 +311,11 @@ srecord::interval::union_(const interval &left, const interval &right)
 // NAME
 //      interval_intersection - intersection of two intervals
 //
-// SYNOPSIS
-//      interval_ty *interval_intersection(interval_ty *left,
-//          interval_ty *right);
-//
 // DESCRIPTION
 //      The interval_intersection function is used to form the
-//      intersection of two intervals.
-//
-// ARGUMENTS
-//      left    - interval to be intersected with
-//      right   - another interval
-//
-// RETURNS
-//      a pointer to the new interval in dynamic memory
-//
-// CAVEAT
-//      It is the responsibility of the caller to release the
-//      interval to dynamic memory when no longer required.
-//      Use the interval_free function for this purpose.
+//      intersection of two intervals.  Each run of the smaller is
+//      looked up in the larger, so the cost is proportional to the
+//      size of the smaller and the result, not the larger.
 //
 
 srecord::interval
@@ -419,54 +323,21 @@ srecord::interval::intersection(const interval &left, const interval &right)
 {
     // assert(left.valid());
     // assert(right.valid());
+    if (left.runs.size() < right.runs.size())
+        return intersection(right, left);
     interval result;
-    size_t left_pos = 0;
-    size_t right_pos = 0;
-    int count = 0;
-    for (;;)
+    for (const auto &run : right.runs)
     {
-        int old_count = count;
-        data_t place;
-        if (left_pos < left.length)
+        auto it = left.runs.upper_bound(run.first);
+        if (it != left.runs.begin())
+            --it;
+        for (; it != left.runs.end() && it->first < run.second; ++it)
         {
-            if (right_pos < right.length)
-            {
-                long_data_t left_val =
-                    promote(left.data[left_pos], left_pos);
-                long_data_t right_val =
-                    promote(right.data[right_pos], right_pos);
-                if (left_val < right_val)
-                {
-                    count += (left_pos & 1 ? -1 : 1);
-                    place = left.data[left_pos++];
-                }
-                else
-                {
-                    count += (right_pos & 1 ? -1 : 1);
-                    place = right.data[right_pos++];
-                }
-            }
-            else
-            {
-                count += (left_pos & 1 ? -1 : 1);
-                place = left.data[left_pos++];
-            }
-        }
-        else
-        {
-            if (right_pos < right.length)
-            {
-                count += (right_pos & 1 ? -1 : 1);
-                place = right.data[right_pos++];
-            }
-            else
-                break;
+            long_data_t lo = std::max<long_data_t>(it->first, run.first);
+            long_data_t hi = std::min(it->second, run.second);
+            result.insert_run(lo, hi);
         }
-        if ((count >= 2) != (old_count >= 2))
-            result.append(place);
     }
-    if (result.length)
-        result.data[result.length] = result.length;
     // assert(result.valid());
     return result;
 }
@@ -476,9 +347,6 @@ srecord::interval::intersection(const interval &left, const interval &right)
 // NAME
 //      interval_difference - difference of two intervals
 //
-// SYNOPSIS
-//      interval_ty *interval_difference(interval_ty *left, interval_ty *right);
-//
 // DESCRIPTION
 //      The interval_difference function is used to form the
 //      difference of two intervals.
@@ -487,67 +355,23 @@ srecord::interval::intersection(const interval &left, const interval &right)
 //      left    - interval to take things out of
 //      right   - things to take out of it
 //
-// RETURNS
-//      a pointer to the new interval in dynamic memory
-//
-// CAVEAT
-//      It is the responsibility of the caller to release the
-//      interval to dynamic memory when no longer required.
-//      Use the interval_free function for this purpose.
-//
 
 srecord::interval
 srecord::interval::difference(const interval &left, const interval &right)
 {
     // assert(left.valid());
     // assert(right.valid());
-    interval result;
-    size_t left_pos = 0;
-    size_t right_pos = 0;
-    int count = 0;
-    for (;;)
+    if (right.runs.size() > left.runs.size())
     {
-        int old_count = count;
-        data_t place;
-        if (left_pos < left.length)
-        {
-            if (right_pos < right.length)
-            {
-                long_data_t left_val = promote(left.data[left_pos], left_pos);
-                long_data_t right_val =
-                    promote(right.data[right_pos], right_pos);
-                if (left_val < right_val)
-                {
-                    count += (left_pos & 1 ? -1 : 1);
-                    place = left.data[left_pos++];
-                }
-                else
-                {
-                    count -= (right_pos & 1 ? -1 : 1);
-                    place = right.data[right_pos++];
-                }
-            }
-            else
-            {
-                count += (left_pos & 1 ? -1 : 1);
-                place = left.data[left_pos++];
-            }
-        }
-        else
-        {
-            if (right_pos < right.length)
-            {
-                count -= (right_pos & 1 ? -1 : 1);
-                place = right.data[right_pos++];
-            }
-            else
-                break;
-        }
-        if ((count >= 1) != (old_count >= 1))
-            result.append(place);
+        //
+        // Only the parts of right which overlap left matter.
+        //
+        interval result(left);
+        result.erase(intersection(left, right));
+        return result;
     }
-    if (result.length)
-        result.data[result.length] = result.length;
+    interval result(left);
+    result.erase(right);
     // assert(result.valid());
     return result;
 }
@@ -557,44 +381,21 @@ srecord::interval::difference(const interval &left, const interval &right)
 // NAME
 //      interval_member - test for membership
 //
-// SYNOPSIS
-//      int interval_member(interval_ty *, interval_data_ty datum);
-//
 // DESCRIPTION
 //      The interval_member function is used to test if a particular
 //      datum is included in an interval.
 //
-// ARGUMENTS
-//      ip      - interval to test
-//      datum   - value to test for
-//
-// RETURNS
-//      int     1 if is a member
-//              0 if is not a member
-//
 
 bool
 srecord::interval::member(data_t datum)
     const
 {
-    if (length == 0)
-        return false;
     // assert(valid());
-    long min = 0;
-    long max = length - 2;
-    while (min <= max)
-    {
-        long mid = ((min + max) / 2) & ~1;
-        data_t lo = data[mid];
-        long_data_t hi = promote(data[mid + 1], mid + 1);
-        if (lo <= datum && datum < hi)
-            return true;
-        if (lo < datum)
-            min = mid + 2;
-        else
-            max = mid - 2;
-    }
-    return false;
+    auto it = runs.upper_bound(datum);
+    if (it == runs.begin())
+        return false;
+    --it;
+    return (datum < it->second);
 }
 
 
@@ -602,27 +403,18 @@ srecord::interval::member(data_t datum)
 // NAME
 //      interval_scan_begin
 //
-// SYNOPSIS
-//      void interval_scan_begin(interval_ty *ip);
-//
 // DESCRIPTION
 //      The interval_scan_begin function is used to
 //      start traversing every datum in the interval.
 //
-// ARGUMENTS
-//      ip      - interval to scan
-//
 
 void
 srecord::interval::scan_begin()
 {
     // assert(valid());
-    // assert(!scan_index);
-    scan_index = 1;
-    if (length)
-        scan_next_datum = data[0];
-    else
-        scan_next_datum = 0;
+    // assert(!scanning);
+    scanning = true;
+    scan_next_datum = (runs.empty() ? 0 : runs.begin()->first);
 }
 
 
@@ -630,37 +422,31 @@ srecord::interval::scan_begin()
 // NAME
 //      interval_scan_next
 //
-// SYNOPSIS
-//      int interval_scan_next(interval_ty *ip, interval_data_ty *datum);
-//
 // DESCRIPTION
 //      The interval_scan_next function is used to
 //      traverse every datum in the interval.
 //
-// ARGUMENTS
-//      ip      - interval to scan
-//      datum   - pointer to where to place datum
-//
 // RETURNS
-//      int     1 if datum available
-//              0 if reached end of interval
+//      bool    true if datum available
+//              false if reached end of interval
 //
 
 bool
 srecord::interval::scan_next(data_t &datum)
 {
     // assert(valid());
-    // assert(scan_index & 1);
-    if (scan_index >= length)
+    // assert(scanning);
+    if (!scanning || scan_next_datum >= ((long_data_t)1 << 32))
         return false;
-    if (scan_next_datum >= promote(data[scan_index], scan_index))
+    auto it = runs.upper_bound((data_t)scan_next_datum);
+    if (it == runs.begin() || scan_next_datum >= std::prev(it)->second)
     {
-        scan_index += 2;
-        if (scan_index >= length)
+        // step over the hole to the next run
+        if (it == runs.end())
             return false;
-        scan_next_datum = data[scan_index - 1];
+        scan_next_datum = it->first;
     }
-    datum = scan_next_datum++;
+    datum = (data_t)scan_next_datum++;
     return true;
 }
 
@@ -669,23 +455,17 @@ srecord::interval::scan_next(data_t &datum)
 // NAME
 //      interval_scan_end
 //
-// SYNOPSIS
-//      void interval_scan_end(interval_ty *ip);
-//
 // DESCRIPTION
 //      The interval_scan_end function is used to
 //      finish traversing every datum in the interval.
 //
-// ARGUMENTS
-//      ip      - interval to scan
-//
 
 void
 srecord::interval::scan_end()
 {
     // assert(valid());
-    // assert(scan_index & 1);
-    scan_index = 0;
+    // assert(scanning);
+    scanning = false;
     scan_next_datum = 0;
 }
 
@@ -694,11 +474,8 @@ void
 srecord::interval::first_interval_only()
 {
     // assert(valid());
-    if (length > 2)
-    {
-        length = 2;
-        data[length] = length;
-    }
+    if (runs.size() > 1)
+        runs.erase(std::next(runs.begin()), runs.end());
 }
 
 
@@ -706,19 +483,14 @@ bool
 srecord::interval::empty()
     const
 {
-    return (length == 0);
+    return runs.empty();
 }
 
 
 bool
 srecord::interval::equal(const interval &lhs, const interval &rhs)
 {
-    if (lhs.length != rhs.length)
-        return false;
-    for (size_t j = 0; j < lhs.length; ++j)
-        if (lhs.data[j] != rhs.data[j])
-            return false;
-    return true;
+    return (lhs.runs == rhs.runs);
 }
 
 
@@ -727,7 +499,7 @@ srecord::interval::get_lowest()
     const
 {
     // assert(valid());
-    return (length > 0 ? data[0] : 0);
+    return (runs.empty() ? 0 : runs.begin()->first);
 }
 
 
@@ -736,7 +508,7 @@ srecord::interval::get_highest()
     const
 {
     // assert(valid());
-    return (length > 0 ? data[length - 1] : 0);
+    return (runs.empty() ? 0 : (data_t)runs.rbegin()->second);
 }
 
 
@@ -744,19 +516,23 @@ void
 srecord::interval::print(std::ostream &os)
     const
 {
-    if (length != 2)
+    if (runs.size() != 1)
         os << "(";
-    for (size_t j = 0; j < length; j += 2)
+    bool first = true;
+    for (const auto &run : runs)
     {
-        if (j)
+        if (!first)
             os << ", ";
-        os << data[j];
-        if (data[j] + 2 == data[j + 1])
-            os << ", " << data[j] + 1;
-        else if (data[j] + 1 != data[j + 1])
-            os << " - " << (data[j + 1] - 1);
+        first = false;
+        data_t lo = run.first;
+        auto hi = (data_t)run.second;
+        os << lo;
+        if (lo + 2 == hi)
+            os << ", " << lo + 1;
+        else if (lo + 1 != hi)
+            os << " - " << (hi - 1);
     }
-    if (length != 2)
+    if (runs.size() != 1)
         os << ")";
 }
 
@@ -781,20 +557,24 @@ srecord::interval::representation()
 {
     std::string result;
     result += '(';
-    for (size_t j = 0; j < length; j += 2)
+    bool first = true;
+    for (const auto &run : runs)
     {
-        if (j)
+        if (!first)
             result += ", ";
-        result += to_string(data[j]);
-        if (data[j] + 2 == data[j + 1])
+        first = false;
+        data_t lo = run.first;
+        auto hi = (data_t)run.second;
+        result += to_string(lo);
+        if (lo + 2 == hi)
         {
             result += ", ";
-            result += to_string(data[j] + 1);
+            result += to_string(lo + 1);
         }
-        else if (data[j] + 1 != data[j + 1])
+        else if (lo + 1 != hi)
         {
             result += " - ";
-            result += to_string(data[j + 1] - 1);
+            result += to_string(hi - 1);
         }
     }
     result += ')';
@@ -809,11 +589,11 @@ srecord::interval::pad(int mult)
     if (mult < 2)
         return *this;
     interval result;
-    for (size_t j = 0; j < length; j += 2)
+    for (const auto &run : runs)
     {
-        data_t lo = data[j];
+        data_t lo = run.first;
         lo = (lo / mult) * mult;
-        data_t hi = data[j + 1];
+        auto hi = (data_t)run.second;
         hi = ((hi + mult - 1) / mult) * mult;
         result += interval(lo, hi);
     }
@@ -23,6 +23,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <map>
+#include <vector>
 
 namespace srecord
 {
@@ -31,6 +33,10 @@ namespace srecord
   * The interval class is used to represent a set of integer values,
   * usually composed of runs of adjacent value.  Set arithmetic is
   * implemented on these intervals.
+  *
+  * The runs are kept in a balanced tree, so adding or removing a
+  * single run costs O(log n) in the number of runs, and adding a run
+  * above everything already present is amortised constant time.
   */
 class interval
 {
@@ -100,6 +106,48 @@ class interval
       */
     static interval difference(const interval &, const interval &);
 
+    /**
+      * The insert method is used to add a run of values to the
+      * interval, in place.
+      *
+      * \param lo
+      *     The lower bound of the values to add.
+      * \param hi
+      *     The upper bound of the values to add; this value is not
+      *     included.  Zero means 2**32, as for the constructor.
+      */
+    void insert(data_t lo, data_t hi);
+
+    /**
+      * The insert method is used to form the union of this interval
+      * and another, in place.
+      */
+    void insert(const interval &arg);
+
+    /**
+      * The erase method is used to remove a run of values from the
+      * interval, in place.
+      *
+      * \param lo
+      *     The lower bound of the values to remove.
+      * \param hi
+      *     The upper bound of the values to remove; this value is not
+      *     included.  Zero means 2**32, as for the constructor.
+      */
+    void erase(data_t lo, data_t hi);
+
+    /**
+      * The erase method is used to form the difference of this
+      * interval and another, in place.
+      */
+    void erase(const interval &arg);
+
+    /**
+      * The retain method is used to form the intersection of this
+      * interval and another, in place.
+      */
+    void retain(const interval &arg);
+
     /**
       * The equal class method is used to test the equality of two
       * intervals.
@@ -206,40 +254,43 @@ class interval
       */
     long_data_t coverage() const;
 
-private:
     /**
-      * The length instance variable is used to remember the length of
-      * the data instance variable.  This is almost always even, because
-      * the internal is a series of [lo, hi) sub-intervals.
+      * The get_runs method is used to obtain the runs of adjacent values
+      * making up the interval, as [lo, hi) pairs in ascending order.  An
+      * upper bound of zero means 2**32.  Walking the pairs is much
+      * cheaper than repeatedly carving off the first_interval_only.
+      *
+      * @param edges
+      *     Where to return the pairs, two values per run.
       */
-    size_t length{0};
+    void get_runs(std::vector<data_t> &edges) const;
 
+private:
     /**
-      * The size instance variable is used to remember the maximum size
-      * of the data instance variable.  The length can go up and down
-      * depending on the calculation, but the size only ever rises.
+      * The runs_t type is used to map the lower bound of each run onto
+      * its (exclusive) upper bound.  The upper bound is held in the
+      * wider type so that 2**32 is representable.  Runs never overlap
+      * nor touch.
       */
-    size_t size{0};
+    typedef std::map<data_t, long_data_t> runs_t;
 
     /**
-      * The scan_index instance variable is used to remember where the
-      * scan us up to.  Used by the scan_next method, et al.
+      * The runs instance variable is used to remember the runs of
+      * adjacent values making up the interval.
       */
-    size_t scan_index{0};
+    runs_t runs;
 
     /**
-      * The scan_next_datum instance variable is used to remember where
-      * the scan us up to.  Used by the scan_next method, et al.
+      * The scanning instance variable is used to remember whether a
+      * scan is in progress.  Used by the scan_next method, et al.
       */
-    data_t scan_next_datum{0};
+    bool scanning{false};
 
     /**
-      * The data instance variable is used to remember a pointer to
-      * the base of an array of integer values.  They come in [lo, hi)
-      * pairs.  As a sanity check, there is an extra item, which contains
-      * the same value as the length instance variable.
+      * The scan_next_datum instance variable is used to remember where
+      * the scan us up to.  Used by the scan_next method, et al.
       */
-    data_t *data{nullptr};
+    long_data_t scan_next_datum{0};
 
     /**
       * The valid method is used to test whether the interval is
@@ -248,13 +299,16 @@ class interval
     bool valid() const;
 
     /**
-      * The append method is used to append another value to the end
-      * of an interval under construction.  This breaks the "length is
-      * even" assertion which usually applies; for this reason it is
-      * only to be used by the arithmetic operator implementations when
-      * calculating their results.
+      * The insert_run method is used to add the values [lo, hi) to the
+      * interval, coalescing with any runs it overlaps or touches.
+      */
+    void insert_run(long_data_t lo, long_data_t hi);
+
+    /**
+      * The erase_run method is used to remove the values [lo, hi) from
+      * the interval, splitting or trimming runs as necessary.
       */
-    void append(data_t);
+    void erase_run(long_data_t lo, long_data_t hi);
 };
 
 /**
@@ -294,7 +348,7 @@ operator * (const interval &lhs, const interval &rhs)
 inline interval &
 operator *= (interval &lhs, const interval &rhs)
 {
-    lhs = interval::intersection(lhs, rhs);
+    lhs.retain(rhs);
     return lhs;
 }
 
@@ -315,7 +369,7 @@ operator + (const interval &lhs, const interval &rhs)
 inline interval &
 operator += (interval &lhs, const interval &rhs)
 {
-    lhs = interval::union_(lhs, rhs);
+    lhs.insert(rhs);
     return lhs;
 }
 
@@ -336,7 +390,7 @@ operator - (const interval &lhs, const interval &rhs)
 inline interval &
 operator -= (interval &lhs, const interval &rhs)
 {
-    lhs = interval::difference(lhs, rhs);
+    lhs.erase(rhs);
     return lhs;
 }
 
@@ -0,0 +1,68 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <algorithm>
+
+#include <srecord/interval/builder.h>
+
+
+void
+srecord::interval_builder::add(interval::data_t lo, interval::data_t hi)
+{
+    interval::long_data_t long_hi =
+        (hi == 0 ? ((interval::long_data_t)1 << 32) : hi);
+    if (lo > long_hi)
+    {
+        // the wrong way round, as for the interval constructor
+        long_hi = lo;
+        lo = hi;
+    }
+    if (lo == long_hi)
+        return;
+    if (!pending.empty() && lo < pending.back().first)
+        ascending = false;
+    pending.emplace_back(lo, long_hi);
+}
+
+
+srecord::interval
+srecord::interval_builder::build()
+{
+    if (!ascending)
+        std::sort(pending.begin(), pending.end());
+
+    //
+    // Coalesce overlapping and adjacent runs here, so that every
+    // insert lands above the interval's current highest value, which
+    // is the constant time case.
+    //
+    interval result;
+    auto it = pending.begin();
+    while (it != pending.end())
+    {
+        interval::data_t lo = it->first;
+        interval::long_data_t hi = it->second;
+        for (++it; it != pending.end() && it->first <= hi; ++it)
+            hi = std::max(hi, it->second);
+        result.insert(lo, (interval::data_t)hi);
+    }
+    pending.clear();
+    ascending = true;
+    return result;
+}
@@ -0,0 +1,103 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_INTERVAL_BUILDER_H
+#define SRECORD_INTERVAL_BUILDER_H
+
+#include <utility>
+#include <vector>
+
+#include <srecord/interval.h>
+
+namespace srecord {
+
+/**
+  * The srecord::interval_builder class is used to accumulate a large
+  * number of runs, in any order, and turn them into an interval in one
+  * go.  The runs are sorted and coalesced once, rather than being
+  * merged into the interval one at a time.
+  */
+class interval_builder
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~interval_builder() = default;
+
+    /**
+      * The default constructor.  No runs have been added.
+      */
+    interval_builder() = default;
+
+    /**
+      * The add method is used to add a run of values.
+      *
+      * @param lo
+      *     The lower bound of the run.
+      * @param hi
+      *     The upper bound of the run; this value is not included.
+      *     Zero means 2**32.  As for the interval constructor, the
+      *     bounds are swapped if they are the wrong way round.
+      */
+    void add(interval::data_t lo, interval::data_t hi);
+
+    /**
+      * The empty method is used to determine whether any runs have
+      * been added.
+      */
+    bool empty() const { return pending.empty(); }
+
+    /**
+      * The build method is used to obtain the union of all of the
+      * runs added so far.  The builder is left empty.
+      */
+    interval build();
+
+private:
+    typedef std::pair<interval::data_t, interval::long_data_t> run_t;
+
+    /**
+      * The pending instance variable is used to remember the runs
+      * added so far, as [lo, hi) pairs.
+      */
+    std::vector<run_t> pending;
+
+    /**
+      * The ascending instance variable is used to remember whether the
+      * runs have been added in ascending order of lower bound, in which
+      * case they need not be sorted.
+      */
+    bool ascending{true};
+
+public:
+    /**
+      * The copy constructor.  Do not use.
+      */
+    interval_builder(const interval_builder &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    interval_builder &operator=(const interval_builder &) = delete;
+};
+
+};
+
+#endif // SRECORD_INTERVAL_BUILDER_H
@@ -25,12 +25,7 @@ srecord::interval::coverage()
     const
 {
     long_data_t total = 0;
-    for (size_t j = 0; j < length; j+= 2)
-    {
-        long_data_t lo = data[j];
-        long_data_t hi =
-            (data[j + 1] == 0 ? ((long_data_t)1 << 32) : data[j + 1]);
-        total += (hi - lo);
-    }
+    for (const auto &run : runs)
+        total += (run.second - run.first);
     return total;
 }
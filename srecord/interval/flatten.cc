@@ -24,7 +24,7 @@ srecord::interval
 srecord::interval::flatten()
     const
 {
-    if (length <= 2)
+    if (runs.size() <= 1)
         return *this;
     return {get_lowest(), get_highest()};
 }
@@ -0,0 +1,34 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/interval.h>
+
+
+void
+srecord::interval::get_runs(std::vector<data_t> &edges)
+    const
+{
+    edges.clear();
+    edges.reserve(runs.size() * 2);
+    for (const auto &run : runs)
+    {
+        edges.push_back(run.first);
+        edges.push_back((data_t)run.second);
+    }
+}
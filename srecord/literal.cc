@@ -0,0 +1,118 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+
+#include <srecord/literal.h>
+
+
+/**
+  * The literal_table class is used to hold the text of all 256 byte
+  * values, in one style.  It is built once, on first use.
+  */
+struct literal_table
+{
+    literal_table(bool hex);
+
+    char text[256][4];
+    unsigned char length[256];
+};
+
+
+literal_table::literal_table(bool hex)
+{
+    for (unsigned n = 0; n < 256; ++n)
+    {
+        char *cp = text[n];
+        if (hex)
+        {
+            cp[0] = '0';
+            cp[1] = 'x';
+            cp[2] = "0123456789ABCDEF"[n >> 4];
+            cp[3] = "0123456789ABCDEF"[n & 15];
+            length[n] = 4;
+        }
+        else if (n >= 100)
+        {
+            cp[0] = '0' + n / 100;
+            cp[1] = '0' + n / 10 % 10;
+            cp[2] = '0' + n % 10;
+            length[n] = 3;
+        }
+        else if (n >= 10)
+        {
+            cp[0] = '0' + n / 10;
+            cp[1] = '0' + n % 10;
+            length[n] = 2;
+        }
+        else
+        {
+            cp[0] = '0' + n;
+            length[n] = 1;
+        }
+    }
+}
+
+
+static const literal_table &
+get_table(bool hex)
+{
+    static const literal_table hex_table(true);
+    static const literal_table dec_table(false);
+    return (hex ? hex_table : dec_table);
+}
+
+
+size_t
+srecord::literal_byte(char *buffer, uint8_t value, bool hex)
+{
+    const literal_table &t = get_table(hex);
+    memcpy(buffer, t.text[value], 4);
+    return t.length[value];
+}
+
+
+size_t
+srecord::literal_word(char *buffer, uint16_t value, bool hex)
+{
+    if (hex)
+    {
+        //
+        // The hex table entries are "0xNN", so the high byte supplies
+        // the prefix and first two digits, and the low byte the rest.
+        //
+        const literal_table &t = get_table(true);
+        memcpy(buffer, t.text[value >> 8], 4);
+        memcpy(buffer + 4, t.text[value & 0xFF] + 2, 2);
+        return 6;
+    }
+    if (value < 256)
+        return literal_byte(buffer, value, false);
+    char tmp[6];
+    char *tp = tmp + sizeof(tmp);
+    unsigned n = value;
+    while (n)
+    {
+        *--tp = '0' + n % 10;
+        n /= 10;
+    }
+    size_t len = tmp + sizeof(tmp) - tp;
+    memcpy(buffer, tp, len);
+    return len;
+}
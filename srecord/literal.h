@@ -0,0 +1,67 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_LITERAL_H
+#define SRECORD_LITERAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace srecord
+{
+
+/**
+  * The literal_byte function is used to render a byte value as a C
+  * style integer literal, without the overhead of printf.  The text is
+  * identical to "0x%2.2X" or "%u", but comes from a pre-computed table.
+  * The result is not NUL terminated.
+  *
+  * @param buffer
+  *     Where to write the text.  There must be room for at least four
+  *     characters.
+  * @param value
+  *     The value to be rendered.
+  * @param hex
+  *     true for hexadecimal, false for decimal
+  * @returns
+  *     the number of characters written
+  */
+size_t literal_byte(char *buffer, uint8_t value, bool hex);
+
+/**
+  * The literal_word function is used to render a 16-bit value as a
+  * C style integer literal, without the overhead of printf.  The text
+  * is identical to "0x%4.4X" or "%u".  The result is not NUL
+  * terminated.
+  *
+  * @param buffer
+  *     Where to write the text.  There must be room for at least six
+  *     characters.
+  * @param value
+  *     The value to be rendered.
+  * @param hex
+  *     true for hexadecimal, false for decimal
+  * @returns
+  *     the number of characters written
+  */
+size_t literal_word(char *buffer, uint16_t value, bool hex);
+
+};
+
+#endif // SRECORD_LITERAL_H
@@ -18,6 +18,9 @@
 //
 
 #include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
 
 #include <srecord/input.h>
 #include <srecord/memory.h>
@@ -165,6 +168,72 @@ srecord::memory::set(uint32_t address, int datum)
 }
 
 
+bool
+srecord::memory::set_fresh(uint32_t address, const uint8_t *data,
+    size_t nbytes)
+{
+    if ((uint64_t)address + nbytes > ((uint64_t)1 << 32))
+        return false;
+
+    uint32_t addr = address;
+    size_t left = nbytes;
+    while (left > 0)
+    {
+        uint32_t address_hi = addr / srecord::memory_chunk::size;
+        uint32_t address_lo = addr % srecord::memory_chunk::size;
+        size_t n = srecord::memory_chunk::size - address_lo;
+        if (n > left)
+            n = left;
+        if (find(address_hi)->any_set_p(address_lo, n))
+            return false;
+        addr += n;
+        left -= n;
+    }
+
+    addr = address;
+    left = nbytes;
+    while (left > 0)
+    {
+        uint32_t address_hi = addr / srecord::memory_chunk::size;
+        uint32_t address_lo = addr % srecord::memory_chunk::size;
+        size_t n = srecord::memory_chunk::size - address_lo;
+        if (n > left)
+            n = left;
+        find(address_hi)->set_block(address_lo, data, n);
+        data += n;
+        addr += n;
+        left -= n;
+    }
+    return true;
+}
+
+
+void
+srecord::memory::fill(const interval &range, int value)
+{
+    std::vector<interval::data_t> runs;
+    range.get_runs(runs);
+    for (size_t j = 0; j < runs.size(); j += 2)
+    {
+        interval::long_data_t lo = runs[j];
+        interval::long_data_t hi = runs[j + 1];
+        if (hi == 0)
+            hi = (interval::long_data_t)1 << 32;
+        while (lo < hi)
+        {
+            uint32_t address_hi = lo / srecord::memory_chunk::size;
+            uint32_t address_lo = lo % srecord::memory_chunk::size;
+            interval::long_data_t nbytes =
+                srecord::memory_chunk::size - address_lo;
+            if (nbytes > hi - lo)
+                nbytes = hi - lo;
+            find(address_hi)->fill(address_lo, nbytes, value);
+            lo += nbytes;
+        }
+    }
+}
+
+
 int
 srecord::memory::get(uint32_t address)
     const
@@ -235,11 +304,41 @@ srecord::memory::get_upper_bound()
 }
 
 
+/**
+  * The union_of_runs function is used to build an interval from a
+  * list of ascending, disjoint [lo, hi) pairs.  The halves are built
+  * separately and then joined, so that each union is of similar sized
+  * intervals, rather than adding the pairs one at a time.
+  */
+static srecord::interval
+union_of_runs(const std::vector<uint32_t> &edges, size_t lo, size_t hi)
+{
+    if (lo >= hi)
+        return srecord::interval();
+    if (hi - lo == 1)
+        return srecord::interval(edges[2 * lo], edges[2 * lo + 1]);
+    size_t mid = lo + (hi - lo) / 2;
+    return (union_of_runs(edges, lo, mid) + union_of_runs(edges, mid, hi));
+}
+
+
+srecord::interval
+srecord::memory::get_extents()
+    const
+{
+    std::vector<uint32_t> edges;
+    for (int j = 0; j < nchunks; ++j)
+        chunk[j]->find_runs(edges);
+    return union_of_runs(edges, 0, edges.size() / 2);
+}
+
+
 void
 srecord::memory::walk(srecord::memory_walker::pointer w)
     const
 {
     w->notify_upper_bound(get_upper_bound());
+    w->notify_layout(get_extents());
     w->observe_header(get_header());
     for (int j = 0; j < nchunks; ++j)
         chunk[j]->walk(w);
@@ -251,111 +350,322 @@ srecord::memory::walk(srecord::memory_walker::pointer w)
 }
 
 
+/**
+  * The memory_walker_runs class is used to make a list of the runs of
+  * data a walk would observe, so that memory::walk_parallel can share
+  * them out between its slices.
+  */
+class memory_walker_runs:
+    public srecord::memory_walker
+{
+public:
+    struct run
+    {
+        uint32_t address;
+        const uint8_t *data;
+        size_t size;
+
+        // The number of bytes of data before this run.
+        size_t offset;
+    };
+
+    std::vector<run> runs;
+    size_t total{0};
+
+    void
+    observe(uint32_t address, const void *data, int data_size) override
+    {
+        runs.push_back({ address, (const uint8_t *)data, size_t(data_size),
+            total });
+        total += data_size;
+    }
+};
+
+
+/**
+  * The walk_parallel_min constant is the least amount of data each
+  * slice should be given when memory::walk_parallel chooses the number
+  * of slices itself.  Any less, and starting the thread costs more
+  * than it saves.
+  */
+static const size_t walk_parallel_min = 1 << 20;
+
+
+/**
+  * The walk_slice function is used to have one walker observe the
+  * bytes from begin to end of the data, counting from the start of
+  * the first run.
+  */
+static void
+walk_slice(const std::vector<memory_walker_runs::run> &runs,
+    srecord::memory_walker::pointer w, size_t begin, size_t end)
+{
+    for (const memory_walker_runs::run &r : runs)
+    {
+        if (r.offset + r.size <= begin)
+            continue;
+        if (r.offset >= end)
+            break;
+        size_t lo = (begin > r.offset ? begin : r.offset) - r.offset;
+        size_t hi = (end < r.offset + r.size ? end : r.offset + r.size)
+            - r.offset;
+        w->observe(r.address + lo, r.data + lo, hi - lo);
+    }
+}
+
+
+void
+srecord::memory::walk_parallel(srecord::memory_walker::pointer w,
+    unsigned nslices)
+    const
+{
+    std::shared_ptr<memory_walker_runs> runs(new memory_walker_runs);
+    for (int j = 0; j < nchunks; ++j)
+        chunk[j]->walk(runs);
+
+    //
+    // Work out how many slices to cut the data into.  The boundaries
+    // between slices must fall on a multiple of the walker's alignment,
+    // so there can't be more slices than that allows.
+    //
+    size_t total = runs->total;
+    if (nslices == 0)
+    {
+        nslices = std::thread::hardware_concurrency();
+        if (nslices > total / walk_parallel_min)
+            nslices = total / walk_parallel_min;
+    }
+    size_t alignment = w->get_slice_alignment();
+    if (nslices > total / alignment)
+        nslices = total / alignment;
+    std::vector<srecord::memory_walker::pointer> walkers;
+    walkers.push_back(w);
+    while (walkers.size() < nslices)
+    {
+        srecord::memory_walker::pointer s = w->slice();
+        if (!s)
+            break;
+        walkers.push_back(s);
+    }
+    nslices = walkers.size();
+
+    std::vector<size_t> bounds;
+    for (unsigned k = 0; k < nslices; ++k)
+        bounds.push_back(total * k / nslices / alignment * alignment);
+    bounds.push_back(total);
+
+    w->notify_upper_bound(get_upper_bound());
+    w->notify_layout(get_extents());
+    w->observe_header(get_header());
+
+    //
+    // The first slice is observed by this thread, the rest by threads
+    // of their own.  Then the results are put back together, in
+    // address order.
+    //
+    std::vector<std::thread> threads;
+    for (unsigned k = 1; k < nslices; ++k)
+    {
+        threads.emplace_back
+        (
+            walk_slice,
+            std::cref(runs->runs),
+            walkers[k],
+            bounds[k],
+            bounds[k + 1]
+        );
+    }
+    walk_slice(runs->runs, w, bounds[0], bounds[1]);
+    for (std::thread &t : threads)
+        t.join();
+    for (unsigned k = 1; k < nslices; ++k)
+        w->combine(*walkers[k], bounds[k + 1] - bounds[k]);
+
+    w->observe_end();
+
+    // Only write an execution start address record if we were given one.
+    if (execution_start_address)
+        w->observe_start_address(get_execution_start_address());
+}
+
+
+void
+srecord::memory::walk_incremental(srecord::memory_walker::pointer w)
+{
+    std::string key = w->get_summary_key();
+    if (key.empty())
+    {
+        walk(w);
+        return;
+    }
+
+    //
+    // Summarise each chunk, reusing the summaries which are still
+    // valid.  Each summary must start on a multiple of the walker's
+    // alignment, counting in bytes of data, so all but the last must
+    // be a whole number of multiples long.
+    //
+    size_t alignment = w->get_slice_alignment();
+    std::vector<const srecord::memory_chunk::summary *> summaries;
+    for (int j = 0; j < nchunks; ++j)
+    {
+        const srecord::memory_chunk::summary *sp =
+            chunk[j]->get_summary(key, *w);
+        if (!sp || (j + 1 < nchunks && sp->nbytes % alignment != 0))
+        {
+            walk(w);
+            return;
+        }
+        summaries.push_back(sp);
+    }
+
+    w->notify_upper_bound(get_upper_bound());
+    w->notify_layout(get_extents());
+    w->observe_header(get_header());
+    for (const srecord::memory_chunk::summary *sp : summaries)
+        w->combine(*sp->walker, sp->nbytes);
+    w->observe_end();
+
+    // Only write an execution start address record if we were given one.
+    if (execution_start_address)
+        w->observe_start_address(get_execution_start_address());
+}
+
+
 void
 srecord::memory::reader(const srecord::input::pointer &ifp,
     defcon_t redundant_bytes,
     defcon_t contradictory_bytes)
 {
+    //
+    // If the memory is empty, any constant fill the input would
+    // generate once its data is exhausted can't overlap anything, so
+    // it can go straight into memory, rather than be carved into
+    // records and checked a byte at a time.
+    //
+    bool fill_deferred = (empty() && ifp->defer_fill());
+
     srecord::record record;
     while (ifp->read(record))
+        add_record(ifp, record, redundant_bytes, contradictory_bytes);
+
+    if (fill_deferred)
     {
-        switch (record.get_type())
+        interval range;
+        int value = 0;
+        if (ifp->get_deferred_fill(range, value))
+            fill(range, value);
+    }
+}
+
+
+void
+srecord::memory::add_record(const srecord::input::pointer &ifp,
+    const srecord::record &record, defcon_t redundant_bytes,
+    defcon_t contradictory_bytes)
+{
+    switch (record.get_type())
+    {
+    case srecord::record::type_header:
+        if (!header)
         {
-        case srecord::record::type_header:
-            if (!header)
-            {
-                header = new srecord::record(record);
-            }
-            break;
+            header = new srecord::record(record);
+        }
+        break;
+
+    case srecord::record::type_unknown:
+    case srecord::record::type_data_count:
+        break;
 
-        case srecord::record::type_unknown:
-        case srecord::record::type_data_count:
+    case srecord::record::type_data:
+        if (set_fresh(record.get_address(), record.get_data(),
+            record.get_length()))
+        {
             break;
+        }
 
-        case srecord::record::type_data:
-            //
-            // For each data byte, we have to check for duplicates.  We
-            // issue warnings for redundant settings, and we issue error
-            // for contradictory settings.
-            //
-            for (size_t j = 0; j < record.get_length(); ++j)
+        //
+        // For each data byte, we have to check for duplicates.  We
+        // issue warnings for redundant settings, and we issue error
+        // for contradictory settings.
+        //
+        for (size_t j = 0; j < record.get_length(); ++j)
+        {
+            srecord::record::address_t address = record.get_address() + j;
+            int n = record.get_data(j);
+            if (set_p(address))
             {
-                srecord::record::address_t address = record.get_address() + j;
-                int n = record.get_data(j);
-                if (set_p(address))
+                int old = get(address);
+                if (n == old)
                 {
-                    int old = get(address);
-                    if (n == old)
+                    // duplicate
+                    switch (redundant_bytes)
                     {
-                        // duplicate
-                        switch (redundant_bytes)
-                        {
-                        default:
-                        case defcon_ignore:
-                            break;
-
-                        case defcon_warning:
-                            ifp->warning
-                            (
-                                "redundant 0x%08lX value (0x%02X)",
-                                (long)address,
-                                n
-                            );
-                            break;
-
-                        case defcon_fatal_error:
-                            ifp->fatal_error
-                            (
-                                "redundant 0x%08lX value (0x%02X)",
-                                (long)address,
-                                n
-                            );
-                            break;
-                        }
+                    default:
+                    case defcon_ignore:
+                        break;
+
+                    case defcon_warning:
+                        ifp->warning
+                        (
+                            "redundant 0x%08lX value (0x%02X)",
+                            (long)address,
+                            n
+                        );
+                        break;
+
+                    case defcon_fatal_error:
+                        ifp->fatal_error
+                        (
+                            "redundant 0x%08lX value (0x%02X)",
+                            (long)address,
+                            n
+                        );
+                        break;
                     }
-                    else
+                }
+                else
+                {
+                    // contradicts
+                    switch (contradictory_bytes)
                     {
-                        // contradicts
-                        switch (contradictory_bytes)
-                        {
-                        case defcon_ignore:
-                            break;
-
-                        case defcon_warning:
-                            ifp->warning
-                            (
-                                "multiple 0x%08lX values (previous = 0x%02X, "
-                                    "this one = 0x%02X)",
-                                (long)address,
-                                old,
-                                n
-                            );
-                            break;
-
-                        case defcon_fatal_error:
-                            ifp->fatal_error
-                            (
-                                "multiple 0x%08lX values (previous = 0x%02X, "
-                                    "this one = 0x%02X)",
-                                (long)address,
-                                old,
-                                n
-                            );
-                            break;
-                        }
+                    case defcon_ignore:
+                        break;
+
+                    case defcon_warning:
+                        ifp->warning
+                        (
+                            "multiple 0x%08lX values (previous = 0x%02X, "
+                                "this one = 0x%02X)",
+                            (long)address,
+                            old,
+                            n
+                        );
+                        break;
+
+                    case defcon_fatal_error:
+                        ifp->fatal_error
+                        (
+                            "multiple 0x%08lX values (previous = 0x%02X, "
+                                "this one = 0x%02X)",
+                            (long)address,
+                            old,
+                            n
+                        );
+                        break;
                     }
                 }
-                set(address, n);
             }
-            break;
+            set(address, n);
+        }
+        break;
 
-        case srecord::record::type_execution_start_address:
-            if (!execution_start_address)
-            {
-                execution_start_address = new srecord::record(record);
-            }
-            break;
+    case srecord::record::type_execution_start_address:
+        if (!execution_start_address)
+        {
+            execution_start_address = new srecord::record(record);
         }
+        break;
     }
 }
 
@@ -423,6 +733,27 @@ srecord::memory::find_next_data(uint32_t &address, void *data,
 }
 
 
+void
+srecord::memory::forget_below(uint32_t address)
+{
+    uint32_t address_hi = address / srecord::memory_chunk::size;
+    int n = 0;
+    while (n < nchunks && chunk[n]->get_address() < address_hi)
+    {
+        if (cache == chunk[n])
+            cache = 0;
+        delete chunk[n];
+        ++n;
+    }
+    if (n == 0)
+        return;
+    for (int j = n; j < nchunks; ++j)
+        chunk[j - n] = chunk[j];
+    nchunks -= n;
+    find_next_chunk_index = 0;
+}
+
+
 srecord::record *
 srecord::memory::get_header()
     const
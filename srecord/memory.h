@@ -24,6 +24,7 @@
 
 #include <srecord/defcon.h>
 #include <srecord/input.h>
+#include <srecord/interval.h>
 #include <srecord/memory/chunk.h>
 #include <srecord/memory/walker.h>
 #include <srecord/string.h>
@@ -69,6 +70,18 @@ class memory
       */
     void set(uint32_t address, int value);
 
+    /**
+      * The fill method is used to set every byte in the given address
+      * range to the given value, a chunk at a time.  No checks are made
+      * for bytes which were already set.
+      *
+      * @param range
+      *     The addresses to be set.
+      * @param value
+      *     The value to set them to.
+      */
+    void fill(const interval &range, int value);
+
     /**
       * The get method is used to fetch the value of the byte at
       * the given 'address'.
@@ -96,9 +109,64 @@ class memory
     /**
       * The walk method is used to apply a memory_walker derived
       * class to every byte of memory.
+      *
+      * Data is observed in ascending address order, one call per
+      * contiguous run within each memory chunk.  A run which continues
+      * across a chunk boundary is observed as consecutive calls with
+      * adjacent addresses; use a srecord::memory_walker_reblock to
+      * have it delivered as exact-sized blocks.
       */
     void walk(memory_walker::pointer) const;
 
+    /**
+      * The walk_parallel method is used to apply a memory_walker
+      * derived class to every byte of memory, the same as the #walk
+      * method, except that the data is cut into address-ordered
+      * slices, and each slice observed on a thread of its own by a
+      * walker made with memory_walker::slice.  The slices are then
+      * put back together, in order, with memory_walker::combine.
+      *
+      * Walkers which can not be sliced, and memory with too little
+      * data to be worth the threads, are simply walked.
+      *
+      * @param w
+      *     The walker to be applied.
+      * @param nslices
+      *     The number of slices to cut the data into, or zero to choose
+      *     according to the number of processors and the amount of
+      *     data.
+      */
+    void walk_parallel(memory_walker::pointer w, unsigned nslices = 0) const;
+
+    /**
+      * The walk_incremental method is used to apply a memory_walker
+      * derived class to every byte of memory, the same as the #walk
+      * method, except that each chunk's data is observed by a walker
+      * made with memory_walker::slice, which the chunk keeps, filed
+      * under memory_walker::get_summary_key, until its data next
+      * changes (e.g. by #set).  The slices are then put back together,
+      * in order, with memory_walker::combine.  Walking the same
+      * calculation again, after patching a few bytes, only observes
+      * the chunks that changed.
+      *
+      * This is for programs using the library which keep an image in
+      * memory, patch it, and check it again, such as a tool stamping
+      * serial numbers into a firmware image and working out its CRC
+      * each time.  The srec_cat filters and srec_info only walk their
+      * data once, so they use #walk or #walk_parallel instead.
+      *
+      * Walkers with no summary key, or whose slice alignment the
+      * chunks' data does not meet, are simply walked.
+      *
+      * Because it updates the summaries the chunks keep, this method is
+      * not const, and, unlike #walk, it must not be called on the same
+      * memory from more than one thread at a time.
+      *
+      * @param w
+      *     The walker to be applied.
+      */
+    void walk_incremental(memory_walker::pointer w);
+
     /**
       * The reader method is used to read the given `input' source
       * into memory.  This method may be called multiple times,
@@ -108,6 +176,10 @@ class memory
       * header, the first header will be remembered, if set_header()
       * was not called previously.
       *
+      * If the memory is empty, and the input ends with a constant fill
+      * (the -fill filter), the fill is written directly into memory
+      * rather than being read as data records.
+      *
       * @param input
       *     The source of the byte stream
       * @param redundant_bytes
@@ -124,6 +196,26 @@ class memory
     void reader(const input::pointer &input, defcon_t redundant_bytes,
         defcon_t contradictory_bytes);
 
+    /**
+      * The add_record method is used to add one record to memory, the
+      * same way the #reader method adds each record it reads.  Data
+      * records set the bytes they hold; the first header and execution
+      * start address records are remembered; others are ignored.
+      *
+      * @param input
+      *     The source of the record, for any diagnostics.
+      * @param record
+      *     The record to be added.
+      * @param redundant_bytes
+      *     What to do about bytes set again to the same value, see
+      *     #reader.
+      * @param contradictory_bytes
+      *     What to do about bytes set again to a different value, see
+      *     #reader.
+      */
+    void add_record(const input::pointer &input, const record &record,
+        defcon_t redundant_bytes, defcon_t contradictory_bytes);
+
     /**
       * The equal method may be used to determine if two memory
       * instances are equal.
@@ -152,6 +244,18 @@ class memory
     bool find_next_data(uint32_t &address, void *data,
         size_t &nbytes) const;
 
+    /**
+      * The forget_below method is used to discard the data held
+      * entirely below the given address.  This lets a memory image be
+      * handed on to a reader piece by piece (using #find_next_data),
+      * without holding two whole copies of the data at once.
+      *
+      * @param address
+      *     The chunks wholly below this address are discarded.
+      *     The header and execution start address are kept.
+      */
+    void forget_below(uint32_t address);
+
     /**
       * The get_header method is used to determine the value of the
       * header record set by either the reader() or set_header()
@@ -200,6 +304,14 @@ class memory
       */
     uint32_t get_lower_bound() const;
 
+    /**
+      * The get_extents method is used to obtain the address ranges of
+      * the memory image which hold data.  It costs one pass over the
+      * chunk bit maps, plus a little per extent; it does not depend on
+      * how the data arrived (e.g. the number of records read).
+      */
+    interval get_extents() const;
+
     /**
       * The get_upper_bound method is used to obtain the upper bound
       * (maximum address plus one) of the memory image.
@@ -261,6 +373,25 @@ class memory
       */
     memory_chunk *find(uint32_t address) const;
 
+    /**
+      * The set_fresh method is used to copy a run of bytes into memory,
+      * provided none of them have been set before.  This lets the
+      * #reader skip its byte-by-byte duplicate checks for the usual
+      * case of data which does not overlap anything.
+      *
+      * @param address
+      *     The address of the first byte.
+      * @param data
+      *     The values of the bytes.
+      * @param nbytes
+      *     The number of bytes.
+      * @returns
+      *     true if the bytes were copied, false (and nothing was
+      *     changed) if any of them were already set, or the run wraps
+      *     past the top of the address space.
+      */
+    bool set_fresh(uint32_t address, const uint8_t *data, size_t nbytes);
+
     /**
       * The cache instance variable is used to accelerate the find()
       * method, based on the fact that most memory accesses are
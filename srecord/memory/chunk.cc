@@ -18,6 +18,7 @@
 //
 
 
+#include <bitset>
 #include <cstring>
 #include <srecord/memory/chunk.h>
 #include <srecord/memory/walker.h>
@@ -32,7 +33,8 @@ srecord::memory_chunk::memory_chunk(uint32_t arg) :
 
 
 srecord::memory_chunk::memory_chunk(const srecord::memory_chunk &arg) :
-    address(arg.address)
+    address(arg.address),
+    summaries(arg.summaries)
 {
     memcpy(data, arg.data, sizeof(data));
     memcpy(mask, arg.mask, sizeof(mask));
@@ -47,6 +49,7 @@ srecord::memory_chunk::operator=(const srecord::memory_chunk &arg)
         address = arg.address;
         memcpy(data, arg.data, sizeof(data));
         memcpy(mask, arg.mask, sizeof(mask));
+        summaries = arg.summaries;
     }
     return *this;
 }
@@ -57,6 +60,76 @@ srecord::memory_chunk::set(uint32_t offset, int datum)
 {
     data[offset] = datum;
     mask[offset >> 3] |= (1 << (offset & 7));
+    if (!summaries.empty())
+        summaries.clear();
+}
+
+
+void
+srecord::memory_chunk::mark(uint32_t offset, uint32_t nbytes)
+{
+    if (!summaries.empty())
+        summaries.clear();
+    uint32_t end = offset + nbytes;
+    while (offset < end && (offset & 7))
+    {
+        mask[offset >> 3] |= (1 << (offset & 7));
+        ++offset;
+    }
+    if (end - offset >= 8)
+    {
+        memset(mask + (offset >> 3), 0xFF, (end - offset) >> 3);
+        offset += (end - offset) & ~7u;
+    }
+    while (offset < end)
+    {
+        mask[offset >> 3] |= (1 << (offset & 7));
+        ++offset;
+    }
+}
+
+
+void
+srecord::memory_chunk::fill(uint32_t offset, uint32_t nbytes, int datum)
+{
+    memset(data + offset, datum, nbytes);
+    mark(offset, nbytes);
+}
+
+
+void
+srecord::memory_chunk::set_block(uint32_t offset, const uint8_t *a_data,
+    uint32_t nbytes)
+{
+    memcpy(data + offset, a_data, nbytes);
+    mark(offset, nbytes);
+}
+
+
+bool
+srecord::memory_chunk::any_set_p(uint32_t offset, uint32_t nbytes)
+    const
+{
+    uint32_t end = offset + nbytes;
+    while (offset < end && (offset & 7))
+    {
+        if (mask[offset >> 3] & (1 << (offset & 7)))
+            return true;
+        ++offset;
+    }
+    while (end - offset >= 8)
+    {
+        if (mask[offset >> 3])
+            return true;
+        offset += 8;
+    }
+    while (offset < end)
+    {
+        if (mask[offset >> 3] & (1 << (offset & 7)))
+            return true;
+        ++offset;
+    }
+    return false;
 }
 
 
@@ -145,6 +218,82 @@ srecord::memory_chunk::get_upper_bound()
 }
 
 
+void
+srecord::memory_chunk::find_runs(std::vector<uint32_t> &edges)
+    const
+{
+    //
+    // Whole mask bytes, or eight of them at once, are skipped at a time
+    // where possible, so that densely filled chunks cost one test per
+    // 64 data bytes.
+    //
+    static const uint8_t ones[8] =
+        { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    static const uint8_t zeros[8] = { 0 };
+    size_t j = 0;
+    while (j < size)
+    {
+        if (j % 64 == 0 && j + 64 <= size && !memcmp(mask + j / 8, zeros, 8))
+        {
+            j += 64;
+            continue;
+        }
+        if (j % 8 == 0 && j + 8 <= size && mask[j / 8] == 0)
+        {
+            j += 8;
+            continue;
+        }
+        if (!set_p(j))
+        {
+            ++j;
+            continue;
+        }
+        size_t k = j + 1;
+        for (;;)
+        {
+            if (k % 64 == 0 && k + 64 <= size && !memcmp(mask + k / 8, ones, 8))
+                k += 64;
+            else if (k % 8 == 0 && k + 8 <= size && mask[k / 8] == 0xFF)
+                k += 8;
+            else if (k < size && set_p(k))
+                ++k;
+            else
+                break;
+        }
+        uint32_t lo = address * size + j;
+        uint32_t hi = address * size + k;
+        if (!edges.empty() && edges.back() == lo)
+            edges.back() = hi;
+        else
+        {
+            edges.push_back(lo);
+            edges.push_back(hi);
+        }
+        j = k;
+    }
+}
+
+
+const srecord::memory_chunk::summary *
+srecord::memory_chunk::get_summary(const std::string &key,
+        const memory_walker &w)
+{
+    auto it = summaries.find(key);
+    if (it != summaries.end())
+        return &it->second;
+
+    summary result;
+    result.walker = w.slice();
+    if (!result.walker)
+        return 0;
+    walk(result.walker);
+    result.nbytes = 0;
+    for (uint8_t m : mask)
+        result.nbytes += std::bitset<8>(m).count();
+    return &(summaries[key] = result);
+}
+
+
 uint32_t
 srecord::memory_chunk::get_lower_bound()
     const
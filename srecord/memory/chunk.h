@@ -20,6 +20,9 @@
 #define SRECORD_MEMORY_CHUNK_H
 
 #include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
 
 #include <srecord/memory/walker.h>
 
@@ -44,9 +47,10 @@ class memory_chunk
       *     masks and bit shifts.
       * @note
       *     If you change this value, you will have to change tests
-      *     test/01/t0199a.sh and test/02/t0200a.sh to match,
-      *     otherwise it will fail.  Make sure that interactions with
-      *     srecord::output_filter_reblock are what you intended, too.
+      *     test/01/t0199a.sh, test/02/t0200a.sh and test/02/t0271a.sh
+      *     to match, otherwise they will fail.  Make sure that
+      *     interactions with srecord::memory_walker_reblock are what
+      *     you intended, too.
       */
     size = 7 * 256 };
 
@@ -76,6 +80,46 @@ class memory_chunk
       */
     void set(uint32_t offset, int value);
 
+    /**
+      * The fill method is used to set a run of bytes within the chunk
+      * to the same value.
+      *
+      * @param offset
+      *     The offset of the first byte within the chunk.
+      * @param nbytes
+      *     The number of bytes to set.  The run must not extend past
+      *     the end of the chunk.
+      * @param value
+      *     The value to set them to.
+      */
+    void fill(uint32_t offset, uint32_t nbytes, int value);
+
+    /**
+      * The set_block method is used to set a run of bytes within the
+      * chunk.
+      *
+      * @param offset
+      *     The offset of the first byte within the chunk.
+      * @param data
+      *     The values to set them to.
+      * @param nbytes
+      *     The number of bytes to set.  The run must not extend past
+      *     the end of the chunk.
+      */
+    void set_block(uint32_t offset, const uint8_t *data, uint32_t nbytes);
+
+    /**
+      * The any_set_p method is used to determine whether any of a run
+      * of bytes within the chunk contains valid data.
+      *
+      * @param offset
+      *     The offset of the first byte within the chunk.
+      * @param nbytes
+      *     The number of bytes to check.  The run must not extend past
+      *     the end of the chunk.
+      */
+    bool any_set_p(uint32_t offset, uint32_t nbytes) const;
+
     /**
       * The get method is used to get the value at the given offset
       * within the chunk.
@@ -128,6 +172,52 @@ class memory_chunk
       */
     uint32_t get_lower_bound() const;
 
+    /**
+      * The find_runs method is used to append the runs of valid data in
+      * the chunk to a list of [lo, hi) memory byte address pairs.  A
+      * run which continues the last pair already in the list extends
+      * it, so calling this for each chunk in ascending order yields the
+      * extents of the whole image.
+      *
+      * @param edges
+      *     The list of address pairs to append to.
+      */
+    void find_runs(std::vector<uint32_t> &edges) const;
+
+    /**
+      * The summary struct is used to remember a walker, made by
+      * memory_walker::slice, which has observed all of the chunk's
+      * data.  See memory::walk_incremental for how they are used.
+      */
+    struct summary
+    {
+        /**
+          * The walker which observed the chunk's data.
+          */
+        memory_walker::pointer walker;
+
+        /**
+          * The number of bytes of data it observed.
+          */
+        size_t nbytes;
+    };
+
+    /**
+      * The get_summary method is used to obtain the summary of the
+      * chunk's data for the given calculation, making it if it has not
+      * been made since the data last changed.
+      *
+      * @param key
+      *     The name of the calculation, settings included.
+      * @param w
+      *     The walker to be summarised, if need be, using its #slice
+      *     method.
+      * @returns
+      *     the summary, or NULL if the walker can not be sliced.
+      */
+    const summary *get_summary(const std::string &key,
+        const memory_walker &w);
+
 private:
     /**
       * The address of the memory chunk.  This is NOT the address of
@@ -147,6 +237,19 @@ class memory_chunk
       */
     uint8_t mask[(size + 7) / 8]{};
 
+    /**
+      * The mark method is used to flag a run of bytes within the chunk
+      * as containing valid data.
+      */
+    void mark(uint32_t offset, uint32_t nbytes);
+
+    /**
+      * The summaries instance variable is used to remember the
+      * summaries of the chunk's data made by #get_summary, by
+      * calculation.  They are discarded whenever the data changes.
+      */
+    std::map<std::string, summary> summaries;
+
 public:
     /**
       * The default constructor.
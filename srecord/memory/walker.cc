@@ -28,6 +28,13 @@ srecord::memory_walker::notify_upper_bound(uint32_t)
 }
 
 
+void
+srecord::memory_walker::notify_layout(const srecord::interval &)
+{
+    // Do nothing.
+}
+
+
 void
 srecord::memory_walker::observe_header(const srecord::record *)
 {
@@ -47,3 +54,34 @@ srecord::memory_walker::observe_end()
 {
     // Do nothing.
 }
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker::slice()
+    const
+{
+    return pointer();
+}
+
+
+size_t
+srecord::memory_walker::get_slice_alignment()
+    const
+{
+    return 1;
+}
+
+
+void
+srecord::memory_walker::combine(const memory_walker &, size_t)
+{
+    // Do nothing.
+}
+
+
+std::string
+srecord::memory_walker::get_summary_key()
+    const
+{
+    return std::string();
+}
@@ -20,10 +20,14 @@
 #ifndef SRECORD_MEMORY_WALKER_H
 #define SRECORD_MEMORY_WALKER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 
 namespace srecord {
 
+class interval; // forward
 class record; // forward
 
 /**
@@ -72,6 +76,17 @@ class memory_walker
       */
     virtual void notify_upper_bound(uint32_t address);
 
+    /**
+      * The notify_layout method is used to notify the walker of the
+      * extents (the address ranges holding data) of the observe calls
+      * to come.  Shall be called before any observe calls are made.
+      * By default, nothing happens.
+      *
+      * @param extents
+      *     The address ranges of the used memory.
+      */
+    virtual void notify_layout(const interval &extents);
+
     /**
       * The observe_header method is used to inform the walker of the
       * header record.  The default does nothing.
@@ -90,6 +105,52 @@ class memory_walker
       */
     virtual void observe_start_address(const record *rec = 0);
 
+    /**
+      * The slice method is used to create a new walker, with the same
+      * settings as this one but none of its running state, so that
+      * part of the data can be observed on another thread.  See
+      * memory::walk_parallel for how the slices are put back together.
+      *
+      * @returns
+      *     the new walker, or NULL if this walker can not be split up.
+      *     The default returns NULL.
+      */
+    virtual pointer slice() const;
+
+    /**
+      * The get_slice_alignment method is used to obtain the number of
+      * bytes of data the boundaries between slices must be a multiple
+      * of.  The default is one.
+      */
+    virtual size_t get_slice_alignment() const;
+
+    /**
+      * The combine method is used to fold the results of a walker made
+      * by #slice into this one, as if this walker had observed the
+      * same data itself.  The default does nothing.
+      *
+      * @param later
+      *     A walker made by #slice, which has observed the data that
+      *     immediately follows the data observed by this walker.
+      * @param nbytes
+      *     The number of bytes of data observed by later.
+      */
+    virtual void combine(const memory_walker &later, size_t nbytes);
+
+    /**
+      * The get_summary_key method is used to obtain a name for the
+      * calculation a slice of this walker makes, settings included, so
+      * that slices may be kept and used again by
+      * memory::walk_incremental.  Walkers with the same key must make
+      * slices that observe data the same way, and combine with each
+      * other.
+      *
+      * @returns
+      *     the key, or the empty string if this walker's slices can not
+      *     be kept.  The default returns the empty string.
+      */
+    virtual std::string get_summary_key() const;
+
 protected:
     /**
       * The default constructor.  May only be called by derived classes.
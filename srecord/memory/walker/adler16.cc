@@ -21,6 +21,14 @@
 #include <srecord/output.h>
 
 
+srecord::memory_walker_adler16::memory_walker_adler16(
+        const adler16 &a_checksum) :
+    checksum(a_checksum)
+{
+    checksum.clear();
+}
+
+
 srecord::memory_walker_adler16::pointer
 srecord::memory_walker_adler16::create()
 {
@@ -42,3 +50,28 @@ srecord::memory_walker_adler16::get()
 {
     return checksum.get();
 }
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_adler16::slice()
+    const
+{
+    return memory_walker::pointer(new memory_walker_adler16(checksum));
+}
+
+
+void
+srecord::memory_walker_adler16::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_adler16 &>(later);
+    checksum.combine(rhs.checksum, nbytes);
+}
+
+
+std::string
+srecord::memory_walker_adler16::get_summary_key()
+    const
+{
+    return "adler16";
+}
@@ -21,6 +21,14 @@
 #include <srecord/output.h>
 
 
+srecord::memory_walker_adler32::memory_walker_adler32(
+        const adler32 &a_checksum) :
+    checksum(a_checksum)
+{
+    checksum.clear();
+}
+
+
 srecord::memory_walker_adler32::pointer
 srecord::memory_walker_adler32::create()
 {
@@ -42,3 +50,28 @@ srecord::memory_walker_adler32::get()
 {
     return checksum.get();
 }
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_adler32::slice()
+    const
+{
+    return memory_walker::pointer(new memory_walker_adler32(checksum));
+}
+
+
+void
+srecord::memory_walker_adler32::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_adler32 &>(later);
+    checksum.combine(rhs.checksum, nbytes);
+}
+
+
+std::string
+srecord::memory_walker_adler32::get_summary_key()
+    const
+{
+    return "adler32";
+}
@@ -48,6 +48,15 @@ class memory_walker_adler32:
       */
     memory_walker_adler32()  = default;
 
+    /**
+      * The slice constructor.  It is private on purpose, use the
+      * #slice method instead.
+      *
+      * @param checksum
+      *     The checksum calculation whose settings are to be copied.
+      */
+    memory_walker_adler32(const adler32 &checksum);
+
 public:
     /**
       * The create class method is used to create new dynamically
@@ -61,6 +70,15 @@ class memory_walker_adler32:
       */
     unsigned get() const;
 
+    // See base class for documentation.
+    memory_walker::pointer slice() const override;
+
+    // See base class for documentation.
+    void combine(const memory_walker &later, size_t nbytes) override;
+
+    // See base class for documentation.
+    std::string get_summary_key() const override;
+
 protected:
     // See base class for documentation.
     void observe(uint32_t, const void *, int) override;
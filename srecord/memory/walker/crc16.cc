@@ -17,6 +17,8 @@
 // <http://www.gnu.org/licenses/>.
 //
 
+#include <cstdio>
+
 #include <srecord/memory/walker/crc16.h>
 #include <srecord/output.h>
 
@@ -34,6 +36,14 @@ srecord::memory_walker_crc16::memory_walker_crc16(crc16::seed_mode_t seed_mode,
 }
 
 
+srecord::memory_walker_crc16::memory_walker_crc16(
+        const crc16 &a_checksum) :
+    checksum(new crc16(a_checksum))
+{
+    checksum->clear();
+}
+
+
 srecord::memory_walker_crc16::pointer
 srecord::memory_walker_crc16::create(crc16::seed_mode_t arg1, bool a_augment,
     uint16_t polynomial, crc16::bit_direction_t a_bitdir)
@@ -66,3 +76,40 @@ srecord::memory_walker_crc16::get()
 {
     return checksum->get();
 }
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_crc16::slice()
+    const
+{
+    return memory_walker::pointer(new memory_walker_crc16(*checksum));
+}
+
+
+void
+srecord::memory_walker_crc16::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_crc16 &>(later);
+    checksum->combine(*rhs.checksum, nbytes);
+}
+
+
+std::string
+srecord::memory_walker_crc16::get_summary_key()
+    const
+{
+    const char *order = "msb";
+    if (checksum->get_bit_direction() == crc16::bit_direction_least_to_most)
+        order = "lsb";
+    char buffer[40];
+    snprintf
+    (
+        buffer,
+        sizeof(buffer),
+        "crc16 %04X %s",
+        checksum->get_polynomial(),
+        order
+    );
+    return buffer;
+}
@@ -28,6 +28,14 @@ srecord::memory_walker_crc32::memory_walker_crc32(
 }
 
 
+srecord::memory_walker_crc32::memory_walker_crc32(
+        const crc32 &a_checksum) :
+    checksum(a_checksum)
+{
+    checksum.clear();
+}
+
+
 srecord::memory_walker_crc32::pointer
 srecord::memory_walker_crc32::create(crc32::seed_mode_t seed_mode)
 {
@@ -49,3 +57,28 @@ srecord::memory_walker_crc32::get()
 {
     return checksum.get();
 }
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_crc32::slice()
+    const
+{
+    return memory_walker::pointer(new memory_walker_crc32(checksum));
+}
+
+
+void
+srecord::memory_walker_crc32::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_crc32 &>(later);
+    checksum.combine(rhs.checksum, nbytes);
+}
+
+
+std::string
+srecord::memory_walker_crc32::get_summary_key()
+    const
+{
+    return "crc32";
+}
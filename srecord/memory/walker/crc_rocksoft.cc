@@ -0,0 +1,97 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstdio>
+
+#include <srecord/memory/walker/crc_rocksoft.h>
+
+
+srecord::memory_walker_crc_rocksoft::memory_walker_crc_rocksoft(
+        const crc_rocksoft::model &parameters) :
+    checksum(parameters)
+{
+}
+
+
+srecord::memory_walker_crc_rocksoft::memory_walker_crc_rocksoft(
+        const crc_rocksoft &a_checksum) :
+    checksum(a_checksum)
+{
+    checksum.clear();
+}
+
+
+srecord::memory_walker_crc_rocksoft::pointer
+srecord::memory_walker_crc_rocksoft::create(
+    const crc_rocksoft::model &parameters)
+{
+    return pointer(new memory_walker_crc_rocksoft(parameters));
+}
+
+
+void
+srecord::memory_walker_crc_rocksoft::observe(uint32_t, const void *data,
+    int length)
+{
+    checksum.nextbuf(data, length);
+}
+
+
+uint64_t
+srecord::memory_walker_crc_rocksoft::get()
+    const
+{
+    return checksum.get();
+}
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_crc_rocksoft::slice()
+    const
+{
+    return memory_walker::pointer(new memory_walker_crc_rocksoft(checksum));
+}
+
+
+void
+srecord::memory_walker_crc_rocksoft::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_crc_rocksoft &>(later);
+    checksum.combine(rhs.checksum, nbytes);
+}
+
+
+std::string
+srecord::memory_walker_crc_rocksoft::get_summary_key()
+    const
+{
+    const crc_rocksoft::model &m = checksum.get_model();
+    char buffer[60];
+    snprintf
+    (
+        buffer,
+        sizeof(buffer),
+        "crc %u %llX %s",
+        m.width,
+        (unsigned long long)m.polynomial,
+        (m.reflect_in ? "lsb" : "msb")
+    );
+    return buffer;
+}
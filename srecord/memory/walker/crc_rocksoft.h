@@ -0,0 +1,120 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_MEMORY_WALKER_CRC_ROCKSOFT_H
+#define SRECORD_MEMORY_WALKER_CRC_ROCKSOFT_H
+
+#include <srecord/crc_rocksoft.h>
+#include <srecord/memory/walker.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::memory_walker_crc_rocksoft class is used to represent
+  * the parse state of a memory walker which calculates a running CRC
+  * described by the Rocksoft model parameters.
+  */
+class memory_walker_crc_rocksoft:
+    public memory_walker
+{
+public:
+    typedef std::shared_ptr<memory_walker_crc_rocksoft> pointer;
+
+    /**
+      * The destructor.
+      */
+    ~memory_walker_crc_rocksoft() override = default;
+
+private:
+    /**
+      * The constructor.  It is private on purpose, use the #create
+      * method instead.
+      *
+      * @param parameters
+      *     The CRC algorithm to calculate.
+      */
+    memory_walker_crc_rocksoft(const crc_rocksoft::model &parameters);
+
+    /**
+      * The slice constructor.  It is private on purpose, use the
+      * #slice method instead.
+      *
+      * @param checksum
+      *     The checksum calculation whose settings are to be copied.
+      */
+    memory_walker_crc_rocksoft(const crc_rocksoft &checksum);
+
+public:
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      *
+      * @param parameters
+      *     The CRC algorithm to calculate.
+      */
+    static pointer create(const crc_rocksoft::model &parameters);
+
+    /**
+      * The get method is used to get the CRC once all memory chunks
+      * have been processed by calls to our observe method.
+      */
+    uint64_t get() const;
+
+    // See base class for documentation.
+    memory_walker::pointer slice() const override;
+
+    // See base class for documentation.
+    void combine(const memory_walker &later, size_t nbytes) override;
+
+    // See base class for documentation.
+    std::string get_summary_key() const override;
+
+protected:
+    // See base class for documentation.
+    void observe(uint32_t, const void *, int) override;
+
+private:
+    /**
+      * The checksum instance variable is used to remember the running
+      * state of the CRC calculation.
+      */
+    crc_rocksoft checksum;
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    memory_walker_crc_rocksoft() = delete;
+
+    /**
+      * The copy constructor.  Do not use.
+      */
+    memory_walker_crc_rocksoft(const memory_walker_crc_rocksoft &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    memory_walker_crc_rocksoft &operator=(
+        const memory_walker_crc_rocksoft &) = delete;
+};
+
+};
+
+#endif // SRECORD_MEMORY_WALKER_CRC_ROCKSOFT_H
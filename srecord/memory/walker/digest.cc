@@ -0,0 +1,42 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/memory/walker/digest.h>
+
+
+srecord::memory_walker_digest::memory_walker_digest(
+        const digest::pointer &a_calc) :
+    calc(a_calc)
+{
+}
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_digest::create(const digest::pointer &a_calc)
+{
+    return pointer(new memory_walker_digest(a_calc));
+}
+
+
+void
+srecord::memory_walker_digest::observe(uint32_t, const void *data,
+    int length)
+{
+    calc->nextbuf(data, length);
+}
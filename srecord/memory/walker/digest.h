@@ -0,0 +1,93 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_MEMORY_WALKER_DIGEST_H
+#define SRECORD_MEMORY_WALKER_DIGEST_H
+
+#include <srecord/digest.h>
+#include <srecord/memory/walker.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::memory_walker_digest class is used to represent the
+  * parse state of a memory walker which feeds the data to one of the
+  * built in message digests.
+  */
+class memory_walker_digest:
+    public memory_walker
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~memory_walker_digest() override = default;
+
+private:
+    /**
+      * The constructor.  It is private on purpose, use the #create
+      * class method instead.
+      *
+      * @param calc
+      *     The message digest calculation to feed the data to.
+      */
+    memory_walker_digest(const digest::pointer &calc);
+
+public:
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      *
+      * @param calc
+      *     The message digest calculation to feed the data to.
+      */
+    static pointer create(const digest::pointer &calc);
+
+protected:
+    // See base class for documentation.
+    void observe(uint32_t, const void *, int) override;
+
+private:
+    /**
+      * The calc instance variable is used to remember the message
+      * digest calculation the data is fed to.
+      */
+    digest::pointer calc;
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    memory_walker_digest() = delete;
+
+    /**
+      * The copy constructor.  Do not use.
+      */
+    memory_walker_digest(const memory_walker_digest &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    memory_walker_digest &operator=(const memory_walker_digest &) = delete;
+};
+
+};
+
+#endif // SRECORD_MEMORY_WALKER_DIGEST_H
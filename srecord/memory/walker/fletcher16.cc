@@ -31,6 +31,14 @@ srecord::memory_walker_fletcher16::memory_walker_fletcher16(
 }
 
 
+srecord::memory_walker_fletcher16::memory_walker_fletcher16(
+        const fletcher16 &a_checksum) :
+    checksum(a_checksum)
+{
+    checksum.clear();
+}
+
+
 srecord::memory_walker_fletcher16::pointer
 srecord::memory_walker_fletcher16::create(int a_sum1, int a_sum2,
     int a_answer, endian_t a_end)
@@ -54,3 +62,28 @@ srecord::memory_walker_fletcher16::get()
 {
     return checksum.get();
 }
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_fletcher16::slice()
+    const
+{
+    return memory_walker::pointer(new memory_walker_fletcher16(checksum));
+}
+
+
+void
+srecord::memory_walker_fletcher16::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_fletcher16 &>(later);
+    checksum.combine(rhs.checksum, nbytes);
+}
+
+
+std::string
+srecord::memory_walker_fletcher16::get_summary_key()
+    const
+{
+    return "fletcher16";
+}
@@ -19,6 +19,15 @@
 #include <srecord/memory/walker/fletcher32.h>
 #include <srecord/output.h>
 
+
+srecord::memory_walker_fletcher32::memory_walker_fletcher32(
+        const fletcher32 &a_checksum) :
+    checksum(a_checksum)
+{
+    checksum.clear();
+}
+
+
 srecord::memory_walker_fletcher32::pointer
 srecord::memory_walker_fletcher32::create()
 {
@@ -40,3 +49,28 @@ srecord::memory_walker_fletcher32::get()
 {
     return checksum.get();
 }
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_fletcher32::slice()
+    const
+{
+    return memory_walker::pointer(new memory_walker_fletcher32(checksum));
+}
+
+
+void
+srecord::memory_walker_fletcher32::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_fletcher32 &>(later);
+    checksum.combine(rhs.checksum, nbytes);
+}
+
+
+std::string
+srecord::memory_walker_fletcher32::get_summary_key()
+    const
+{
+    return "fletcher32";
+}
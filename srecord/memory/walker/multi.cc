@@ -0,0 +1,147 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <srecord/memory/walker/multi.h>
+
+
+srecord::memory_walker_multi::pointer
+srecord::memory_walker_multi::create()
+{
+    return pointer(new memory_walker_multi());
+}
+
+
+void
+srecord::memory_walker_multi::push_back(const memory_walker::pointer &w)
+{
+    walkers.push_back(w);
+}
+
+
+void
+srecord::memory_walker_multi::observe(uint32_t address, const void *data,
+    int data_size)
+{
+    for (const memory_walker::pointer &w : walkers)
+        w->observe(address, data, data_size);
+}
+
+
+void
+srecord::memory_walker_multi::observe_end()
+{
+    for (const memory_walker::pointer &w : walkers)
+        w->observe_end();
+}
+
+
+void
+srecord::memory_walker_multi::notify_upper_bound(uint32_t address)
+{
+    for (const memory_walker::pointer &w : walkers)
+        w->notify_upper_bound(address);
+}
+
+
+void
+srecord::memory_walker_multi::notify_layout(const interval &extents)
+{
+    for (const memory_walker::pointer &w : walkers)
+        w->notify_layout(extents);
+}
+
+
+void
+srecord::memory_walker_multi::observe_header(const record *rec)
+{
+    for (const memory_walker::pointer &w : walkers)
+        w->observe_header(rec);
+}
+
+
+void
+srecord::memory_walker_multi::observe_start_address(const record *rec)
+{
+    for (const memory_walker::pointer &w : walkers)
+        w->observe_start_address(rec);
+}
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_multi::slice()
+    const
+{
+    pointer result(new memory_walker_multi());
+    for (const memory_walker::pointer &w : walkers)
+    {
+        memory_walker::pointer s = w->slice();
+        if (!s)
+            return memory_walker::pointer();
+        result->push_back(s);
+    }
+    return result;
+}
+
+
+size_t
+srecord::memory_walker_multi::get_slice_alignment()
+    const
+{
+    size_t result = 1;
+    for (const memory_walker::pointer &w : walkers)
+    {
+        size_t a = w->get_slice_alignment();
+        size_t x = result;
+        size_t y = a;
+        while (y)
+        {
+            size_t t = x % y;
+            x = y;
+            y = t;
+        }
+        result = result / x * a;
+    }
+    return result;
+}
+
+
+void
+srecord::memory_walker_multi::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_multi &>(later);
+    for (size_t j = 0; j < walkers.size(); ++j)
+        walkers[j]->combine(*rhs.walkers[j], nbytes);
+}
+
+
+std::string
+srecord::memory_walker_multi::get_summary_key()
+    const
+{
+    std::string result = "multi";
+    for (const memory_walker::pointer &w : walkers)
+    {
+        std::string key = w->get_summary_key();
+        if (key.empty())
+            return key;
+        result += " (" + key + ")";
+    }
+    return result;
+}
@@ -0,0 +1,128 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_MEMORY_WALKER_MULTI_H
+#define SRECORD_MEMORY_WALKER_MULTI_H
+
+#include <vector>
+
+#include <srecord/memory/walker.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::memory_walker_multi class is used to represent a memory
+  * walker which passes everything it observes on to several other
+  * walkers, so that any number of checksums and message digests may be
+  * calculated in a single pass over the data.
+  */
+class memory_walker_multi:
+    public memory_walker
+{
+public:
+    typedef std::shared_ptr<memory_walker_multi> pointer;
+
+    /**
+      * The destructor.
+      */
+    ~memory_walker_multi() override = default;
+
+private:
+    /**
+      * The default constructor.  It is private on purpose, use the
+      * #create method instead.
+      */
+    memory_walker_multi() = default;
+
+public:
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      */
+    static pointer create();
+
+    /**
+      * The push_back method is used to add another walker to the set
+      * to be given the data.  Shall be called before the walk starts.
+      *
+      * @param w
+      *     The walker to be added.
+      */
+    void push_back(const memory_walker::pointer &w);
+
+    // See base class for documentation.
+    void observe(uint32_t address, const void *data, int data_size) override;
+
+    // See base class for documentation.
+    void observe_end() override;
+
+    // See base class for documentation.
+    void notify_upper_bound(uint32_t address) override;
+
+    // See base class for documentation.
+    void notify_layout(const interval &extents) override;
+
+    // See base class for documentation.
+    void observe_header(const record *rec) override;
+
+    // See base class for documentation.
+    void observe_start_address(const record *rec) override;
+
+    /**
+      * The slice method is used to create a new walker holding a slice
+      * of each of our walkers.  If any one of them can not be split
+      * up, none of them are.
+      */
+    memory_walker::pointer slice() const override;
+
+    /**
+      * The get_slice_alignment method is used to obtain the least
+      * common multiple of our walkers' slice alignments.
+      */
+    size_t get_slice_alignment() const override;
+
+    // See base class for documentation.
+    void combine(const memory_walker &later, size_t nbytes) override;
+
+    // See base class for documentation.
+    std::string get_summary_key() const override;
+
+private:
+    /**
+      * The walkers instance variable is used to remember the walkers
+      * to be given the data, in the order they were added.
+      */
+    std::vector<memory_walker::pointer> walkers;
+
+public:
+    /**
+      * The copy constructor.
+      */
+    memory_walker_multi(const memory_walker_multi &) = delete;
+
+    /**
+      * The assignment operator.
+      */
+    memory_walker_multi &operator=(const memory_walker_multi &) = delete;
+};
+
+};
+
+#endif // SRECORD_MEMORY_WALKER_MULTI_H
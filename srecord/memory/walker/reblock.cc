@@ -0,0 +1,169 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at your
+// option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <cassert>
+#include <cstring>
+
+#include <srecord/memory/walker/reblock.h>
+
+
+srecord::memory_walker_reblock::memory_walker_reblock(
+    const memory_walker::pointer &a_deeper,
+    unsigned a_block_size,
+    bool a_align
+) :
+    deeper(a_deeper),
+    block_size(a_block_size),
+    align(a_align)
+{
+    assert(block_size >= 1);
+    assert(block_size <= record::max_data_length);
+}
+
+
+srecord::memory_walker_reblock::pointer
+srecord::memory_walker_reblock::create(const memory_walker::pointer &a_deeper,
+    unsigned a_block_size, bool a_align)
+{
+    return pointer(new memory_walker_reblock(a_deeper, a_block_size, a_align));
+}
+
+
+unsigned
+srecord::memory_walker_reblock::block_room(uint32_t address)
+    const
+{
+    return (block_size - (address - origin) % block_size);
+}
+
+
+void
+srecord::memory_walker_reblock::flush()
+{
+    if (pending_size == 0)
+        return;
+    deeper->observe(pending_address, pending_data, pending_size);
+    pending_size = 0;
+}
+
+
+void
+srecord::memory_walker_reblock::observe(uint32_t address, const void *data,
+    int data_size)
+{
+    const auto *dp = (const uint8_t *)data;
+    unsigned len = data_size;
+    if (len == 0)
+        return;
+
+    if (pending_size != 0 && address != pending_address + pending_size)
+    {
+        // There is a hole, the pending block is as long as it gets.
+        flush();
+    }
+
+    if (pending_size != 0)
+    {
+        //
+        // The run continues across a memory chunk boundary.  This is
+        // the only case where the data has to be copied, so that the
+        // block can be handed over in one piece.
+        //
+        if (pending_data != staging)
+        {
+            memcpy(staging, pending_data, pending_size);
+            pending_data = staging;
+        }
+        unsigned room = block_room(pending_address) - pending_size;
+        unsigned n = (len < room ? len : room);
+        memcpy(staging + pending_size, dp, n);
+        pending_size += n;
+        address += n;
+        dp += n;
+        len -= n;
+        if (n < room)
+            return;
+        flush();
+    }
+    else if (!align)
+    {
+        // A new run, blocks are measured from here.
+        origin = address;
+    }
+
+    //
+    // Hand over all of the complete blocks straight from the memory
+    // image, no copying required.
+    //
+    for (;;)
+    {
+        unsigned room = block_room(address);
+        if (len < room)
+            break;
+        deeper->observe(address, dp, room);
+        address += room;
+        dp += room;
+        len -= room;
+    }
+
+    //
+    // Keep the remainder, it may be continued by the next chunk.
+    //
+    if (len)
+    {
+        pending_address = address;
+        pending_data = dp;
+        pending_size = len;
+    }
+}
+
+
+void
+srecord::memory_walker_reblock::observe_end()
+{
+    flush();
+    deeper->observe_end();
+}
+
+
+void
+srecord::memory_walker_reblock::notify_upper_bound(uint32_t address)
+{
+    deeper->notify_upper_bound(address);
+}
+
+
+void
+srecord::memory_walker_reblock::notify_layout(const interval &extents)
+{
+    deeper->notify_layout(extents);
+}
+
+
+void
+srecord::memory_walker_reblock::observe_header(const record *rp)
+{
+    deeper->observe_header(rp);
+}
+
+
+void
+srecord::memory_walker_reblock::observe_start_address(const record *rp)
+{
+    deeper->observe_start_address(rp);
+}
@@ -0,0 +1,184 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at your
+// option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_MEMORY_WALKER_REBLOCK_H
+#define SRECORD_MEMORY_WALKER_REBLOCK_H
+
+#include <srecord/memory/walker.h>
+#include <srecord/record.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::memory_walker_reblock class is used to represent a
+  * memory walker which re-slices the data observed into blocks of an
+  * exact size, before passing them on to a deeper walker.
+  *
+  * Runs of data which continue across srecord::memory_chunk boundaries
+  * are treated as a single run, so the internal chunk size is not
+  * visible in the output.  Blocks which lie within a single chunk are
+  * passed on directly from the memory image; only blocks which
+  * straddle a chunk boundary are copied.
+  */
+class memory_walker_reblock:
+    public memory_walker
+{
+public:
+    typedef std::shared_ptr<memory_walker_reblock> pointer;
+
+    /**
+      * The destructor.
+      */
+    ~memory_walker_reblock() override = default;
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.
+      *
+      * @param deeper
+      *     Where to send the re-blocked data.
+      * @param block_size
+      *     The number of bytes in each block (1..255).
+      * @param align
+      *     Whether or not to align blocks on block_size boundaries
+      *     (that is, to use short blocks after holes to force
+      *     alignment), rather than packing them as tightly as possible.
+      */
+    static pointer create(const memory_walker::pointer &deeper,
+        unsigned block_size, bool align = false);
+
+protected:
+    // See base class for documentation.
+    void observe(uint32_t, const void *, int) override;
+
+    // See base class for documentation.
+    void observe_end() override;
+
+    // See base class for documentation.
+    void notify_upper_bound(uint32_t) override;
+
+    // See base class for documentation.
+    void notify_layout(const interval &) override;
+
+    // See base class for documentation.
+    void observe_header(const record *) override;
+
+    // See base class for documentation.
+    void observe_start_address(const record *) override;
+
+private:
+    /**
+      * The constructor.
+      * It is private on purpose, use the #create class method instead.
+      *
+      * @param deeper
+      *     Where to send the re-blocked data.
+      * @param block_size
+      *     The number of bytes in each block.
+      * @param align
+      *     Whether or not to align blocks on block_size boundaries.
+      */
+    memory_walker_reblock(const memory_walker::pointer &deeper,
+        unsigned block_size, bool align);
+
+    /**
+      * The deeper instance variable is used to remember where to send
+      * the re-blocked data.
+      */
+    memory_walker::pointer deeper;
+
+    /**
+      * The block_size instance variable is used to remember the number
+      * of bytes in each block.
+      */
+    unsigned block_size;
+
+    /**
+      * The align instance variable is used to remember whether or not
+      * blocks are aligned on block_size boundaries.
+      */
+    bool align;
+
+    /**
+      * The origin instance variable is used to remember the address
+      * from which block boundaries are measured.  It is zero when
+      * aligning, otherwise it is the start of the current run.
+      */
+    uint32_t origin{0};
+
+    /**
+      * The pending_address instance variable is used to remember the
+      * address of the partial block waiting to be completed.  Not
+      * meaningful if #pending_size is zero.
+      */
+    uint32_t pending_address{0};
+
+    /**
+      * The pending_data instance variable is used to remember the data
+      * of the partial block waiting to be completed.  It points into
+      * the memory image, until the block needs to be joined with data
+      * from another chunk, at which time it is copied to #staging.
+      */
+    const uint8_t *pending_data{nullptr};
+
+    /**
+      * The pending_size instance variable is used to remember the
+      * number of bytes in the partial block waiting to be completed.
+      */
+    unsigned pending_size{0};
+
+    /**
+      * The staging instance variable is used to hold blocks which
+      * straddle memory chunk boundaries.
+      */
+    uint8_t staging[record::max_data_length]{};
+
+    /**
+      * The block_room method is used to determine how many bytes may
+      * be placed into a block starting at the given address, before
+      * the next block boundary.
+      */
+    unsigned block_room(uint32_t address) const;
+
+    /**
+      * The flush method is used to pass any pending partial block to
+      * the deeper walker.
+      */
+    void flush();
+
+public:
+    /**
+      * The default constructor.  Do not use.
+      */
+    memory_walker_reblock() = delete;
+
+    /**
+      * The copy constructor.  Do not use.
+      */
+    memory_walker_reblock(const memory_walker_reblock &) = delete;
+
+    /**
+      * The assignment operator.  Do not use.
+      */
+    memory_walker_reblock &operator=(const memory_walker_reblock &) = delete;
+};
+
+};
+
+#endif // SRECORD_MEMORY_WALKER_REBLOCK_H
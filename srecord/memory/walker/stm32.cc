@@ -33,6 +33,14 @@
 #include <srecord/output.h>
 
 
+srecord::memory_walker_stm32::memory_walker_stm32(
+        const stm32 &a_checksum) :
+    checksum(a_checksum)
+{
+    checksum.clear();
+}
+
+
 srecord::memory_walker_stm32::pointer
 srecord::memory_walker_stm32::create()
 {
@@ -54,3 +62,37 @@ srecord::memory_walker_stm32::get()
 {
     return checksum.get();
 }
+
+
+srecord::memory_walker::pointer
+srecord::memory_walker_stm32::slice()
+    const
+{
+    return memory_walker::pointer(new memory_walker_stm32(checksum));
+}
+
+
+size_t
+srecord::memory_walker_stm32::get_slice_alignment()
+    const
+{
+    // The checksum is only of whole words.
+    return 4;
+}
+
+
+void
+srecord::memory_walker_stm32::combine(const memory_walker &later,
+    size_t nbytes)
+{
+    const auto &rhs = dynamic_cast<const memory_walker_stm32 &>(later);
+    checksum.combine(rhs.checksum, nbytes);
+}
+
+
+std::string
+srecord::memory_walker_stm32::get_summary_key()
+    const
+{
+    return "stm32";
+}
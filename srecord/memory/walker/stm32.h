@@ -66,6 +66,18 @@ class memory_walker_stm32:
       */
     unsigned get() const;
 
+    // See base class for documentation.
+    memory_walker::pointer slice() const override;
+
+    // See base class for documentation.
+    size_t get_slice_alignment() const override;
+
+    // See base class for documentation.
+    void combine(const memory_walker &later, size_t nbytes) override;
+
+    // See base class for documentation.
+    std::string get_summary_key() const override;
+
 protected:
     // See base class for documentation.
     void observe(uint32_t, const void *, int) override;
@@ -77,6 +89,15 @@ class memory_walker_stm32:
       */
     memory_walker_stm32() = default;
 
+    /**
+      * The slice constructor.  It is private on purpose, use the
+      * #slice method instead.
+      *
+      * @param checksum
+      *     The checksum calculation whose settings are to be copied.
+      */
+    memory_walker_stm32(const stm32 &checksum);
+
     /**
       * The checksum instance variable is used to remember the running
       * state of the CRC32 (STM32) checksum calculation.
@@ -43,6 +43,13 @@ srecord::memory_walker_writer::notify_upper_bound(uint32_t address)
 }
 
 
+void
+srecord::memory_walker_writer::notify_layout(const interval &extents)
+{
+    op->notify_layout(extents);
+}
+
+
 void
 srecord::memory_walker_writer::observe(uint32_t address, const void *data,
     int length)
@@ -65,6 +65,9 @@ class memory_walker_writer:
     // See base class for documentation.
     void notify_upper_bound(uint32_t) override;
 
+    // See base class for documentation.
+    void notify_layout(const interval &) override;
+
     // See base class for documentation.
     void observe_header(const record *) override;
 
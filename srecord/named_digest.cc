@@ -0,0 +1,277 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstdio>
+#include <strings.h>
+
+#include <srecord/memory/walker/adler16.h>
+#include <srecord/memory/walker/adler32.h>
+#include <srecord/memory/walker/crc16.h>
+#include <srecord/memory/walker/crc32.h>
+#include <srecord/memory/walker/crc_rocksoft.h>
+#include <srecord/memory/walker/digest.h>
+#include <srecord/memory/walker/fletcher16.h>
+#include <srecord/memory/walker/fletcher32.h>
+#include <srecord/memory/walker/stm32.h>
+#include <srecord/named_digest.h>
+#include <srecord/quit.h>
+#include <srecord/sizeof.h>
+
+
+srecord::named_digest::named_digest(const std::string &a_name,
+        kind_t a_kind) :
+    name(a_name),
+    kind(a_kind)
+{
+}
+
+
+srecord::named_digest::pointer
+srecord::named_digest::create(const char *name)
+{
+    struct table_t
+    {
+        const char *name;
+        kind_t kind;
+    };
+
+    static const table_t table[] =
+    {
+        { "Adler16", kind_adler16 },
+        { "Adler32", kind_adler32 },
+        { "CRC16", kind_crc16 },
+        { "CRC32", kind_crc32 },
+        { "Fletcher16", kind_fletcher16 },
+        { "Fletcher32", kind_fletcher32 },
+        { "STM32", kind_stm32 },
+    };
+
+    std::string names;
+    for (const table_t *tp = table; tp < ENDOF(table); ++tp)
+    {
+        if (0 == strcasecmp(name, tp->name))
+            return pointer(new named_digest(tp->name, tp->kind));
+        names += tp->name;
+        names += ", ";
+    }
+
+    digest::pointer calc = digest::create(name);
+    if (calc)
+    {
+        pointer result(new named_digest(calc->get_name(), kind_message));
+        result->calc = calc;
+        return result;
+    }
+
+    const crc_rocksoft::model *mp = crc_rocksoft::model_find(name);
+    if (!mp)
+    {
+        quit_default.fatal_error
+        (
+            "checksum or digest name \"%s\" unknown (known names are "
+                "%s%s, %s)",
+            name,
+            names.c_str(),
+            digest::get_names().c_str(),
+            crc_rocksoft::model_names().c_str()
+        );
+        // NOTREACHED
+        return pointer();
+    }
+    pointer result(new named_digest(mp->name, kind_rocksoft));
+    result->model = mp;
+    return result;
+}
+
+
+srecord::memory_walker::pointer
+srecord::named_digest::start()
+{
+    switch (kind)
+    {
+    case kind_adler16:
+        walker = memory_walker_adler16::create();
+        break;
+
+    case kind_adler32:
+        walker = memory_walker_adler32::create();
+        break;
+
+    case kind_crc16:
+        walker =
+            memory_walker_crc16::create
+            (
+                crc16::seed_mode_ccitt,
+                true,
+                crc16::polynomial_ccitt,
+                crc16::bit_direction_most_to_least
+            );
+        break;
+
+    case kind_crc32:
+        walker = memory_walker_crc32::create(crc32::seed_mode_ccitt);
+        break;
+
+    case kind_fletcher16:
+        walker = memory_walker_fletcher16::create(0xFF, 0xFF, -1, endian_big);
+        break;
+
+    case kind_fletcher32:
+        walker = memory_walker_fletcher32::create();
+        break;
+
+    case kind_message:
+        calc = digest::create(name.c_str());
+        walker = memory_walker_digest::create(calc);
+        break;
+
+    case kind_rocksoft:
+        walker = memory_walker_crc_rocksoft::create(*model);
+        break;
+
+    case kind_stm32:
+        walker = memory_walker_stm32::create();
+        break;
+    }
+    return walker;
+}
+
+
+unsigned
+srecord::named_digest::get_width()
+    const
+{
+    switch (kind)
+    {
+    case kind_adler16:
+    case kind_crc16:
+    case kind_fletcher16:
+        return 16;
+
+    case kind_rocksoft:
+        return model->width;
+
+    case kind_adler32:
+    case kind_crc32:
+    case kind_fletcher32:
+    case kind_message:
+    case kind_stm32:
+        break;
+    }
+    return 32;
+}
+
+
+uint64_t
+srecord::named_digest::get_value()
+    const
+{
+    switch (kind)
+    {
+    case kind_adler16:
+        return static_cast<const memory_walker_adler16 &>(*walker).get();
+
+    case kind_adler32:
+        return static_cast<const memory_walker_adler32 &>(*walker).get();
+
+    case kind_crc16:
+        return static_cast<const memory_walker_crc16 &>(*walker).get();
+
+    case kind_crc32:
+        return static_cast<const memory_walker_crc32 &>(*walker).get();
+
+    case kind_fletcher16:
+        return static_cast<const memory_walker_fletcher16 &>(*walker).get();
+
+    case kind_fletcher32:
+        return static_cast<const memory_walker_fletcher32 &>(*walker).get();
+
+    case kind_rocksoft:
+        return
+            static_cast<const memory_walker_crc_rocksoft &>(*walker).get();
+
+    case kind_stm32:
+        return static_cast<const memory_walker_stm32 &>(*walker).get();
+
+    case kind_message:
+        break;
+    }
+    return 0;
+}
+
+
+std::string
+srecord::named_digest::get_result()
+    const
+{
+    if (kind == kind_message)
+    {
+        uint8_t data[64];
+        calc->get(data);
+        std::string result;
+        for (size_t j = 0; j < calc->get_size(); ++j)
+        {
+            char buf[3];
+            snprintf(buf, sizeof(buf), "%02X", data[j]);
+            result += buf;
+        }
+        return result;
+    }
+
+    int ndigits = (get_width() + 3) / 4;
+    char buf[20];
+    snprintf
+    (
+        buf,
+        sizeof(buf),
+        "%0*llX",
+        ndigits,
+        (unsigned long long)get_value()
+    );
+    return buf;
+}
+
+
+size_t
+srecord::named_digest::get_size()
+    const
+{
+    if (kind == kind_message)
+        return calc->get_size();
+    return (get_width() + 7) / 8;
+}
+
+
+void
+srecord::named_digest::get_bytes(uint8_t *data)
+    const
+{
+    if (kind == kind_message)
+    {
+        calc->get(data);
+        return;
+    }
+    size_t nbytes = get_size();
+    uint64_t value = get_value();
+    for (size_t j = nbytes; j > 0; --j)
+    {
+        data[j - 1] = value;
+        value >>= 8;
+    }
+}
@@ -0,0 +1,184 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_NAMED_DIGEST_H
+#define SRECORD_NAMED_DIGEST_H
+
+#include <string>
+
+#include <srecord/crc_rocksoft.h>
+#include <srecord/digest.h>
+#include <srecord/memory/walker.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::named_digest class is used to represent one of the
+  * checksums or message digests which may be asked for by name, as by
+  * the srec_info -DIGest option and the srec_cat -DIGESTS filter, and
+  * to obtain its value once its walker has seen the data.
+  */
+class named_digest
+{
+public:
+    typedef std::shared_ptr<named_digest> pointer;
+
+    /**
+      * The destructor.
+      */
+    virtual ~named_digest() = default;
+
+    /**
+      * The create class method is used to create new dynamically
+      * allocated instances of this class.  It is a fatal error if the
+      * name is not known.
+      *
+      * @param name
+      *     The name of the checksum or message digest, not case
+      *     sensitive.  Names not otherwise known are looked up in the
+      *     catalogue of CRC algorithms (see srecord::crc_rocksoft).
+      */
+    static pointer create(const char *name);
+
+    /**
+      * The start method is used to begin a new calculation, discarding
+      * any previous one.
+      *
+      * @returns
+      *     the walker to be given the data, in address order.
+      */
+    memory_walker::pointer start();
+
+    /**
+      * The get_name method is used to obtain the name of the checksum
+      * or message digest, for the report.
+      */
+    const std::string &get_name() const { return name; }
+
+    /**
+      * The get_result method is used to obtain the value of the
+      * checksum or message digest, in hexadecimal, once the walker
+      * returned by #start has observed all of the data.
+      */
+    std::string get_result() const;
+
+    /**
+      * The get_size method is used to obtain the number of bytes
+      * needed to hold the value of the checksum or message digest.
+      */
+    size_t get_size() const;
+
+    /**
+      * The get_bytes method is used to obtain the value of the
+      * checksum or message digest as bytes, most significant first,
+      * once the walker returned by #start has observed all of the data.
+      *
+      * @param data
+      *     Where to put the value, at least #get_size bytes.
+      */
+    void get_bytes(uint8_t *data) const;
+
+private:
+    enum kind_t
+    {
+        kind_adler16,
+        kind_adler32,
+        kind_crc16,
+        kind_crc32,
+        kind_fletcher16,
+        kind_fletcher32,
+        kind_message,
+        kind_rocksoft,
+        kind_stm32
+    };
+
+    /**
+      * The constructor.
+      * It is private on purpose, use the #create class method instead.
+      *
+      * @param name
+      *     The name of the checksum or message digest.
+      * @param kind
+      *     The kind of walker needed to calculate it.
+      */
+    named_digest(const std::string &name, kind_t kind);
+
+    /**
+      * The get_width method is used to obtain the width of the
+      * checksum, in bits, when kind is not kind_message.
+      */
+    unsigned get_width() const;
+
+    /**
+      * The get_value method is used to obtain the value of the
+      * checksum, when kind is not kind_message.
+      */
+    uint64_t get_value() const;
+
+    /**
+      * The name instance variable is used to remember the name of the
+      * checksum or message digest, for the report.
+      */
+    std::string name;
+
+    /**
+      * The kind instance variable is used to remember the kind of
+      * walker needed to calculate the checksum or message digest.
+      */
+    kind_t kind;
+
+    /**
+      * The model instance variable is used to remember the parameters
+      * of the CRC, when kind is kind_rocksoft.
+      */
+    const crc_rocksoft::model *model{nullptr};
+
+    /**
+      * The walker instance variable is used to remember the walker of
+      * the calculation in progress.
+      */
+    memory_walker::pointer walker;
+
+    /**
+      * The calc instance variable is used to remember the message
+      * digest in progress, when kind is kind_message.
+      */
+    digest::pointer calc;
+
+public:
+    /**
+      * The default constructor.
+      */
+    named_digest() = delete;
+
+    /**
+      * The copy constructor.
+      */
+    named_digest(const named_digest &) = delete;
+
+    /**
+      * The assignment operator.
+      */
+    named_digest &operator=(const named_digest &) = delete;
+};
+
+};
+
+#endif // SRECORD_NAMED_DIGEST_H
@@ -174,6 +174,12 @@ srecord::output::notify_upper_bound(uint32_t)
 }
 
 
+void
+srecord::output::notify_layout(const srecord::interval &)
+{
+}
+
+
 void
 srecord::output::command_line(srecord::arglex_tool *)
 {
@@ -28,6 +28,7 @@
 namespace srecord {
 
 class arglex_tool; // forward
+class interval; // forward
 class record; // forward
 
 /**
@@ -63,10 +64,24 @@ class output
 
     /**
       * The write_data method is used to write data to the output.
-      * A suitable data record will be produced.  The #write method
-      * will be called.
+      * By default, the data is sliced into suitable data records of
+      * #preferred_block_size_get bytes, and the #write method will be
+      * called for each of them.
+      *
+      * Derived classes may override this method to format the data
+      * directly from the caller's buffer, avoiding the record copy and
+      * the virtual #write call per block.  The result must be identical
+      * to writing the data records.
+      *
+      * @param address
+      *     The address of the first byte of data.
+      * @param data
+      *     The data to be written.
+      * @param length
+      *     The number of bytes of data to be written.
       */
-    virtual void write_data(uint32_t, const void *, size_t);
+    virtual void write_data(uint32_t address, const void *data,
+        size_t length);
 
     /**
       * The write_execution_start_address method is used to write an
@@ -191,6 +206,19 @@ class output
       */
     virtual void notify_upper_bound(uint32_t addr);
 
+    /**
+      * The notify_layout method is used to notify the output class of
+      * the extents (the address ranges holding data) of the output to
+      * come.  When called, it shall be called before the head or any
+      * data records are written.  Formats which summarise the image in
+      * a trailer may use this, rather than accumulating the extents
+      * record by record.  The default implementation does nothing.
+      *
+      * @param extents
+      *     The address ranges of the used memory.
+      */
+    virtual void notify_layout(const interval &extents);
+
     /**
       * The command_line method is used by arglex_srec::get_output when
       * parsing the command line, to give the format an opportunity
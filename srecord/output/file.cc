@@ -20,6 +20,7 @@
 #include <cassert>
 #include <cerrno>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -40,6 +41,12 @@ bool srecord::output_file::enable_optional_address_flag = false;
 srecord::output_file::~output_file()
 {
     FILE *fp = (FILE *)get_fp();
+    if (compression_engine)
+    {
+        compression_flush();
+        compression_engine->finish();
+        compression_engine.reset();
+    }
     if (fflush(fp))
         fatal_error_errno("write");
     if (fp != stdout && fclose(fp))
@@ -95,7 +102,14 @@ srecord::output_file::get_fp()
         // correctly.
         //
 #ifdef __CYGWIN__
-        if (line_termination == line_termination_native && !is_binary())
+        if
+        (
+            line_termination == line_termination_native
+        &&
+            !is_binary()
+        &&
+            compression_guess() == compression_none
+        )
         {
             vfp = fopen(file_name.c_str(), "w");
             if (!vfp)
@@ -111,10 +125,53 @@ srecord::output_file::get_fp()
         }
         set_is_regular();
     }
+    if (!compression_checked)
+        compression_open();
     return vfp;
 }
 
 
+void
+srecord::output_file::put_raw(int c)
+{
+    if (compression_engine)
+    {
+        compression_buffer.push_back(c);
+        if (compression_buffer.size() >= compression_block_size)
+            compression_flush();
+    }
+    else
+        putc(c, (FILE *)vfp);
+}
+
+
+void
+srecord::output_file::put_raw_bytes(const void *data, size_t nbytes)
+{
+    if (!compression_engine)
+    {
+        if (nbytes && fwrite(data, 1, nbytes, (FILE *)vfp) != nbytes)
+            fatal_error_errno("write");
+        return;
+    }
+    if (compression_buffer.size() + nbytes >= compression_block_size)
+    {
+        compression_flush();
+        if (nbytes >= compression_block_size)
+        {
+            //
+            // There is no point copying a block this big into the
+            // buffer, hand it straight to the compressor.
+            //
+            compression_engine->write(data, nbytes);
+            return;
+        }
+    }
+    const auto *cp = (const unsigned char *)data;
+    compression_buffer.insert(compression_buffer.end(), cp, cp + nbytes);
+}
+
+
 std::string
 srecord::output_file::filename()
     const
@@ -141,29 +198,29 @@ srecord::output_file::put_char(int c)
                 continue;
 
             case line_termination_primos:
-                putc('\n', fp);
+                put_raw('\n');
                 ++position;
                 if (position & 1)
                 {
-                    putc(0, fp);
+                    put_raw(0);
                     ++position;
                 }
                 break;
 
             case line_termination_nl:
-                putc('\n', fp);
+                put_raw('\n');
                 ++position;
                 break;
 
             case line_termination_cr:
-                putc('\r', fp);
+                put_raw('\r');
                 ++position;
                 break;
 
             case line_termination_crlf:
-                putc('\r', fp);
+                put_raw('\r');
                 ++position;
-                putc('\n', fp);
+                put_raw('\n');
                 ++position;
                 break;
             }
@@ -172,7 +229,7 @@ srecord::output_file::put_char(int c)
     }
     else
     {
-        putc(c, fp);
+        put_raw(c);
         ++position;
     }
     if (ferror(fp))
@@ -285,13 +342,36 @@ srecord::output_file::seek_to(uint32_t address)
     // this if possible.  (Usually we can, srecord::cat emits records
     // in ascending address order.)
     //
+    // The file must be open before is_regular means anything; opening
+    // it also starts any compression, which clears is_regular.
+    //
+    get_fp();
     if (!is_regular)
     {
+        //
+        // Pad forwards a block at a time; this is also how holes are
+        // written into compressed output.
+        //
+        static const unsigned char zero[256] = { 0 };
         while (position < address)
-            put_char(0);
+        {
+            uint32_t len = address - position;
+            if (len > sizeof(zero))
+                len = sizeof(zero);
+            put_raw_bytes(zero, len);
+            position += len;
+        }
     }
     if (address == position)
         return;
+    if (compression_engine)
+    {
+        fatal_error
+        (
+            "unable to seek backwards to 0x%X in compressed output",
+            address
+        );
+    }
 
     //
     // We'll have to try a seek.
@@ -320,6 +400,35 @@ srecord::output_file::seek_to(uint32_t address)
 }
 
 
+void
+srecord::output_file::put_bytes(const void *data, size_t nbytes)
+{
+    const auto *cp = (const unsigned char *)data;
+    const unsigned char *ep = cp + nbytes;
+    get_fp();
+    while (cp < ep)
+    {
+        //
+        // Text formats need line termination processing, so only the
+        // text between newlines may be written in bulk.
+        //
+        const unsigned char *nl = ep;
+        if (!is_binary())
+        {
+            nl = (const unsigned char *)memchr(cp, '\n', ep - cp);
+            if (!nl)
+                nl = ep;
+        }
+        size_t len = nl - cp;
+        put_raw_bytes(cp, len);
+        position += len;
+        cp = nl;
+        if (cp < ep)
+            put_char(*cp++);
+    }
+}
+
+
 void
 srecord::output_file::put_string(const char *s)
 {
@@ -21,6 +21,8 @@
 #define SRECORD_OUTPUT_FILE_H
 
 #include <string>
+#include <vector>
+#include <srecord/compressor.h>
 #include <srecord/output.h>
 #include <srecord/format_printf.h>
 
@@ -126,6 +128,20 @@ class output_file:
       */
     static bool line_termination_by_name(const std::string &name);
 
+    /**
+      * The compression_by_name method is used to force the output to
+      * be compressed (or not) with a particular method, rather than
+      * guessing from the output file name's suffix (".gz" for gzip,
+      * ".zst" for Zstandard).
+      *
+      * @param name
+      *     The name of the compression method to be used,
+      *     e.g. "gzip" or "none".
+      * @returns
+      *     true if successful, false if name unknown
+      */
+    static bool compression_by_name(const std::string &name);
+
 protected:
     /**
       * The put_char method is used to send a character to the output.
@@ -240,6 +256,20 @@ class output_file:
       */
     void seek_to(uint32_t);
 
+    /**
+      * The put_bytes method is used to send a block of bytes to the
+      * output.  For binary formats this is a single bulk write, rather
+      * than one #put_char call per byte; for text formats the text
+      * between newlines is written in bulk, and #put_char is called for
+      * the newlines, so that line termination is still honoured.
+      *
+      * @param data
+      *     The base address of the bytes to be written.
+      * @param nbytes
+      *     The number of bytes to be written.
+      */
+    void put_bytes(const void *data, size_t nbytes);
+
     /**
       * The put_string method is used to send a nul-terminated C string
       * to the output.  Multiple calls to #put_char are made.
@@ -437,6 +467,78 @@ class output_file:
       */
     virtual bool is_binary() const;
 
+    enum compression_t
+    {
+        compression_auto,
+        compression_none,
+        compression_gzip,
+        compression_zstd
+    };
+
+    /**
+      * The compression class variable is used to remember the desired
+      * output compression method.  Defaults to guessing from the file
+      * name suffix.
+      */
+    static compression_t compression;
+
+    /**
+      * The compression_guess method is used to figure out the
+      * compression method to use for this output file, from the
+      * #compression class variable and the file name suffix.
+      */
+    compression_t compression_guess() const;
+
+    /**
+      * The compression_engine instance variable is used to remember the
+      * compressor the output is being sent through, or NULL if the
+      * output is written to the file as is.
+      */
+    compressor::pointer compression_engine;
+
+    /**
+      * The compression_checked instance variable is used to remember
+      * whether or not the #compression_open method has been called.
+      */
+    bool compression_checked{false};
+
+    /**
+      * The compression_buffer instance variable is used to accumulate
+      * output, so that the compressor may be fed in large blocks.
+      */
+    std::vector<unsigned char> compression_buffer;
+
+    /**
+      * The compression_block_size instance variable is used to remember
+      * the size of the blocks the compressor would like to be fed.
+      */
+    size_t compression_block_size{0};
+
+    /**
+      * The compression_open method is used to start the compressor, if
+      * compressed output has been requested.  It is called once, by
+      * the #get_fp method, after the file has been opened.
+      */
+    void compression_open();
+
+    /**
+      * The compression_flush method is used to pass the accumulated
+      * #compression_buffer contents to the compressor.
+      */
+    void compression_flush();
+
+    /**
+      * The put_raw method is used to send a single byte to the file
+      * (or the compressor), after line termination processing.
+      */
+    void put_raw(int c);
+
+    /**
+      * The put_raw_bytes method is used to send a block of bytes to the
+      * file (or the compressor), after line termination processing.
+      */
+    void put_raw_bytes(const void *data, size_t nbytes);
+
 public:
     /**
       * The copy constructor.
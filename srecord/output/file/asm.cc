@@ -22,18 +22,21 @@
 
 #include <srecord/interval.h>
 #include <srecord/arglex/tool.h>
+#include <srecord/literal.h>
 #include <srecord/output/file/asm.h>
 #include <srecord/record.h>
 
 
 srecord::output_file_asm::~output_file_asm()
 {
+    range_flush();
     if (!section_style && range.empty())
     {
         if (output_word)
             emit_word(0xFFFF);
         else
             emit_byte(0xFF);
+        row_flush();
     }
     if (column)
     {
@@ -201,7 +204,7 @@ srecord::output_file_asm::~output_file_asm()
 
 
 srecord::output_file_asm::output_file_asm(const std::string &filename) :
-    srecord::output_file(filename)
+    srecord::output_file_literal(filename)
 {
 }
 
@@ -276,36 +279,15 @@ void
 srecord::output_file_asm::emit_byte(int n)
 {
     char buffer[8];
-    if (hex_style)
-        sprintf(buffer, "0x%2.2X", (uint8_t)n);
-    else
-        sprintf(buffer, "%u", (uint8_t)n);
-    int len = strlen(buffer);
-    if (column && (column + 1 + len) > line_length)
-    {
-        put_char('\n');
-        column = 0;
-    }
-    if (!column)
-    {
-        if (dot_style)
-        {
-            put_string("        .byte   ");
-            column = 16;
-        }
-        else
-        {
-            put_string("        DB      ");
-            column = 16;
-        }
-    }
-    else
-    {
-        put_char(',');
-        ++column;
-    }
-    put_string(buffer);
-    column += len;
+    size_t len = literal_byte(buffer, n, hex_style);
+    emit_literal
+    (
+        (dot_style ? "        .byte   " : "        DB      "),
+        ",",
+        "",
+        buffer,
+        len
+    );
     ++current_address;
 }
 
@@ -313,37 +295,16 @@ srecord::output_file_asm::emit_byte(int n)
 void
 srecord::output_file_asm::emit_word(unsigned int n)
 {
-    char buffer[16];
-    if (hex_style)
-        snprintf(buffer, sizeof(buffer), "0x%4.4X", (uint16_t)n);
-    else
-        snprintf(buffer, sizeof(buffer), "%u", (uint16_t)n);
-    int len = strlen(buffer);
-    if (column && (column + 1 + len) > line_length)
-    {
-        put_char('\n');
-        column = 0;
-    }
-    if (!column)
-    {
-        if (dot_style)
-        {
-            put_string("        .short      ");
-            column = 20;
-        }
-        else
-        {
-            put_string("        DW      ");
-            column = 16;
-        }
-    }
-    else
-    {
-        put_char(',');
-        ++column;
-    }
-    put_string(buffer);
-    column += len;
+    char buffer[8];
+    size_t len = literal_word(buffer, n, hex_style);
+    emit_literal
+    (
+        (dot_style ? "        .short      " : "        DW      "),
+        ",",
+        "",
+        buffer,
+        len
+    );
     current_address += 2;
 }
 
@@ -387,7 +348,7 @@ srecord::output_file_asm::write(const srecord::record & record)
         //
         // emit the data prelude, if we have not done so already
         //
-        if (section_style && range.empty())
+        if (section_style && range_empty())
         {
             if (dot_style)
             {
@@ -419,7 +380,7 @@ srecord::output_file_asm::write(const srecord::record & record)
                 }
 
                 const char *org = dot_style ? ".org" : "ORG";
-                if (range.empty())
+                if (range_empty())
                 {
                     put_stringf
                     (
@@ -447,35 +408,32 @@ srecord::output_file_asm::write(const srecord::record & record)
             int len = record.get_length();
             if (len & 1)
                 fatal_alignment_error(2);
-            range += interval(record.get_address(), record.get_address() + len);
+            range_add(record.get_address(), record.get_address() + len);
 
             //
             // No attempt is made to align the data on even byte
             // boundaries, use the --fill --range-pad filter for that.
             //
+            const uint8_t *data = record.get_data();
             for (int j = 0; j < len; j += 2)
             {
-                uint8_t n1 = record.get_data(j);
-                uint8_t n2 = record.get_data(j + 1);
                 // little-endian
-                uint16_t n = n1 + (n2 << 8);
-                emit_word(n);
+                emit_word(data[j] + (data[j + 1] << 8));
             }
         }
         else
         {
-            range +=
-                interval
-                (
-                    record.get_address(),
-                    record.get_address() + record.get_length()
-                );
+            range_add
+            (
+                record.get_address(),
+                record.get_address() + record.get_length()
+            );
 
+            const uint8_t *data = record.get_data();
             for (size_t j = 0; j < record.get_length(); ++j)
-            {
-                emit_byte(record.get_data(j));
-            }
+                emit_byte(data[j]);
         }
+        row_flush();
         break;
 
     case srecord::record::type_execution_start_address:
@@ -494,13 +452,6 @@ srecord::output_file_asm::write(const srecord::record & record)
 }
 
 
-void
-srecord::output_file_asm::line_length_set(int n)
-{
-    line_length = n;
-}
-
-
 void
 srecord::output_file_asm::address_length_set(int)
 {
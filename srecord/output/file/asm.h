@@ -20,8 +20,7 @@
 #ifndef SRECORD_OUTPUT_FILE_ASM_H
 #define SRECORD_OUTPUT_FILE_ASM_H
 
-#include <srecord/output/file.h>
-#include <srecord/interval.h>
+#include <srecord/output/file/literal.h>
 
 namespace srecord
 {
@@ -31,7 +30,7 @@ namespace srecord
   * which emits assembler code.
   */
 class output_file_asm:
-    public output_file
+    public output_file_literal
 {
 public:
     /**
@@ -63,9 +62,6 @@ class output_file_asm:
     // See base class for documentation.
     void write(const record &) override;
 
-    // See base class for documentation.
-    void line_length_set(int) override;
-
     // See base class for documentation.
     void address_length_set(int) override;
 
@@ -94,18 +90,6 @@ class output_file_asm:
       */
     uint32_t taddr{0};
 
-    /**
-      * The range instance variable is used to remember the range
-      * of addresses present in the output.
-      */
-    interval range;
-
-    /**
-      * The column instance variable is used to remember the current
-      * printing column on the line.
-      */
-    int column{0};
-
     /**
       * The current_address instance variable is used to remember
       * the current address that the file is positioned at.  This is
@@ -113,12 +97,6 @@ class output_file_asm:
       */
     uint32_t current_address{0};
 
-    /**
-      * The line_length instance variable is used to remember the
-      * maximum line length.  The output usually does not exceed it.
-      */
-    int line_length{75};
-
     /**
       * The org_warn instance variable is used to remember if the ORG
       * directive warning comment has been issued.
@@ -121,14 +121,21 @@ srecord::output_file_basic::write(const srecord::record &record)
         break;
 
     case srecord::record::type_data:
-        if (range.empty())
+        if (!range_written)
             current_address = record.get_address();
-        range +=
-            interval
-            (
-                record.get_address(),
-                record.get_address() + record.get_length()
-            );
+        if (record.get_length())
+        {
+            range_written = true;
+            if (!range_given)
+            {
+                range +=
+                    interval
+                    (
+                        record.get_address(),
+                        record.get_address() + record.get_length()
+                    );
+            }
+        }
         while (current_address < record.get_address())
             emit_byte(0xFF);
         for (size_t j = 0; j < record.get_length(); ++j)
@@ -185,3 +192,11 @@ srecord::output_file_basic::format_name()
 {
     return "Basic";
 }
+
+
+void
+srecord::output_file_basic::notify_layout(const interval &extents)
+{
+    range = extents;
+    range_given = true;
+}
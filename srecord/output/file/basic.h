@@ -78,6 +78,9 @@ class output_file_basic:
     // See base class for documentation.
     const char *format_name() const override;
 
+    // See base class for documentation.
+    void notify_layout(const interval &extents) override;
+
 private:
     /**
       * The taddr instance variable is used to remember the
@@ -91,6 +94,19 @@ class output_file_basic:
       */
     interval range;
 
+    /**
+      * The range_given instance variable is used to remember whether
+      * #range was supplied up front, by the #notify_layout method, in
+      * which case it need not be accumulated as the data is written.
+      */
+    bool range_given{false};
+
+    /**
+      * The range_written instance variable is used to remember whether
+      * or not any data has been written yet.
+      */
+    bool range_written{false};
+
     /**
       * The column instance variable is used to remember the current
       * printing column on the line.
@@ -44,10 +44,22 @@ srecord::output_file_binary::write(const srecord::record &record)
     if (record.get_type() != srecord::record::type_data)
         return;
     seek_to(record.get_address());
-    const uint8_t *data = record.get_data();
-    int length = record.get_length();
-    while (length-- > 0)
-        put_char(*data++);
+    put_bytes(record.get_data(), record.get_length());
+}
+
+
+void
+srecord::output_file_binary::write_data(uint32_t address, const void *data,
+    size_t length)
+{
+    //
+    // There is no record framing in this format, so the data can be
+    // written straight from the caller's buffer.
+    //
+    if (length == 0)
+        return;
+    seek_to(address);
+    put_bytes(data, length);
 }
 
 
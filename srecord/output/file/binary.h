@@ -62,6 +62,10 @@ class output_file_binary:
     // See base class for documentation.
     void write(const record &) override;
 
+    // See base class for documentation.
+    void write_data(uint32_t address, const void *data, size_t length)
+        override;
+
     // See base class for documentation.
     void line_length_set(int) override;
 
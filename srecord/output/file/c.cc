@@ -23,6 +23,7 @@
 
 #include <srecord/interval.h>
 #include <srecord/arglex/tool.h>
+#include <srecord/literal.h>
 #include <srecord/output/file/c.h>
 #include <srecord/record.h>
 
@@ -75,12 +76,14 @@ srecord::output_file_c::~output_file_c()
     // Finish initializing the data array.
     //
     emit_header();
+    range_flush();
     if (range.empty())
     {
         if (output_word)
             emit_word(0xFFFF);
         else
             emit_byte(0xFF);
+        row_flush();
     }
     if (column)
     {
@@ -439,7 +442,7 @@ build_include_file_name(const std::string &filename)
 
 
 srecord::output_file_c::output_file_c(const std::string &a_file_name) :
-    srecord::output_file(a_file_name),
+    srecord::output_file_literal(a_file_name),
     include_file_name(build_include_file_name(a_file_name))
 {
 }
@@ -571,54 +574,16 @@ srecord::output_file_c::emit_header()
 void
 srecord::output_file_c::emit_byte(int n)
 {
-    char buffer[30];
-    if (hex_style)
-        snprintf(buffer, sizeof(buffer), "0x%2.2X", (unsigned char)n);
-    else
-        snprintf(buffer, sizeof(buffer), "%u", (unsigned char)n);
-    int len = strlen(buffer);
-
-    if (column && column + 2 + len > line_length)
-    {
-        put_char('\n');
-        column = 0;
-    }
-    if (column)
-    {
-        put_char(' ');
-        ++column;
-    }
-    put_string(buffer);
-    column += len;
-    put_char(',');
-    ++column;
+    char buffer[8];
+    emit_literal("", " ", ",", buffer, literal_byte(buffer, n, hex_style));
 }
 
 
 void
 srecord::output_file_c::emit_word(unsigned int n)
 {
-    char buffer[30];
-    if (hex_style)
-        snprintf(buffer, sizeof(buffer), "0x%4.4X", (unsigned short)n);
-    else
-        snprintf(buffer, sizeof(buffer), "%u", (unsigned short)n);
-    int len = strlen(buffer);
-
-    if (column && column + 2 + len > line_length)
-    {
-        put_char('\n');
-        column = 0;
-    }
-    if (column)
-    {
-        put_char(' ');
-        ++column;
-    }
-    put_string(buffer);
-    column += len;
-    put_char(',');
-    ++column;
+    char buffer[8];
+    emit_literal("", " ", ",", buffer, literal_word(buffer, n, hex_style));
 }
 
 
@@ -678,7 +643,7 @@ srecord::output_file_c::write(const srecord::record &record)
 
             unsigned long min = record.get_address();
             unsigned long max = record.get_address() + record.get_length();
-            if (!section_style && !range.empty())
+            if (!section_style && !range_empty())
             {
                 // assert(current_address <= min);
                 while (current_address < min)
@@ -688,23 +653,22 @@ srecord::output_file_c::write(const srecord::record &record)
                 }
             }
 
-            range += interval(min, max);
+            range_add(min, max);
 
+            const unsigned char *data = record.get_data();
             for (size_t j = 0; j < record.get_length(); j += 2)
             {
-                unsigned char n1 = record.get_data(j);
-                unsigned char n2 = record.get_data(j + 1);
                 // little endian
-                unsigned short n = n1 + (n2 << 8);
-                emit_word(n);
+                emit_word(data[j] + (data[j + 1] << 8));
             }
+            row_flush();
             current_address = max;
         }
         else
         {
             unsigned long min = record.get_address();
             unsigned long max = record.get_address() + record.get_length();
-            if (!section_style && !range.empty())
+            if (!section_style && !range_empty())
             {
                 // assert(current_address <= min);
                 while (current_address < min)
@@ -714,11 +678,12 @@ srecord::output_file_c::write(const srecord::record &record)
                 }
             }
 
-            range += interval(min, max);
+            range_add(min, max);
+
+            const unsigned char *data = record.get_data();
             for (size_t j = 0; j < record.get_length(); ++j)
-            {
-                emit_byte(record.get_data(j));
-            }
+                emit_byte(data[j]);
+            row_flush();
             current_address = max;
         }
         break;
@@ -730,13 +695,6 @@ srecord::output_file_c::write(const srecord::record &record)
 }
 
 
-void
-srecord::output_file_c::line_length_set(int n)
-{
-    line_length = n;
-}
-
-
 void
 srecord::output_file_c::address_length_set(int n)
 {
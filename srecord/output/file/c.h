@@ -21,8 +21,7 @@
 #ifndef SRECORD_OUTPUT_FILE_C_H
 #define SRECORD_OUTPUT_FILE_C_H
 
-#include <srecord/output/file.h>
-#include <srecord/interval.h>
+#include <srecord/output/file/literal.h>
 
 namespace srecord
 {
@@ -32,7 +31,7 @@ namespace srecord
   * which emits C code.
   */
 class output_file_c:
-    public output_file
+    public output_file_literal
 {
 public:
     /**
@@ -65,9 +64,6 @@ class output_file_c:
     // See base class for documentation.
     void write(const record &) override;
 
-    // See base class for documentation.
-    void line_length_set(int) override;
-
     // See base class for documentation.
     void address_length_set(int) override;
 
@@ -108,24 +104,12 @@ class output_file_c:
       */
     unsigned long taddr{0};
 
-    /**
-      * The range instance variable is used to remember the range
-      * of addresses present in the output.
-      */
-    interval range;
-
     /**
       * The header_done instance variable is used t remember whether
       * the emit_header method has been called.
       */
     bool header_done{false};
 
-    /**
-      * The column instance variable is used to remember the current
-      * printing column on the line.
-      */
-    int column{0};
-
     /**
       * The current_address instance variable is used to remember
       * the current address that the file is positioned at.  This is
@@ -133,12 +117,6 @@ class output_file_c:
       */
     unsigned long current_address{0};
 
-    /**
-      * The line_length instance variable is used to remember the
-      * maximum line length.  The output usually does not exceed it.
-      */
-    int line_length{75};
-
     /**
       * The address_length instance variable is used to remember how
       * many bytes to emit when emitting addresses.
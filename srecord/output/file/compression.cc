@@ -0,0 +1,136 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+
+#include <srecord/arglex.h>
+#include <srecord/compressor/gzip.h>
+#include <srecord/compressor/zstd.h>
+#include <srecord/sizeof.h>
+#include <srecord/output/file.h>
+
+
+srecord::output_file::compression_t srecord::output_file::compression =
+    srecord::output_file::compression_auto;
+
+
+srecord::output_file::compression_t
+srecord::output_file::compression_guess()
+    const
+{
+    if (compression != compression_auto)
+        return compression;
+
+    struct table_t
+    {
+        const char *suffix;
+        compression_t method;
+    };
+    static const table_t table[] =
+    {
+        { ".gz", compression_gzip },
+        { ".zst", compression_zstd },
+    };
+
+    for (const table_t *tp = table; tp < ENDOF(table); ++tp)
+    {
+        size_t len = strlen(tp->suffix);
+        if
+        (
+            file_name.size() > len
+        &&
+            file_name.compare(file_name.size() - len, len, tp->suffix) == 0
+        )
+            return tp->method;
+    }
+    return compression_none;
+}
+
+
+bool
+srecord::output_file::compression_by_name(const std::string &name)
+{
+    struct table_t
+    {
+        const char *name;
+        compression_t method;
+    };
+    static const table_t table[] =
+    {
+        { "Automatic", compression_auto },
+        { "GZip", compression_gzip },
+        { "None", compression_none },
+        { "Zstandard", compression_zstd },
+        { "ZSTd", compression_zstd },
+    };
+
+    for (const table_t *tp = table; tp < ENDOF(table); ++tp)
+    {
+        if (arglex::compare(tp->name, name.c_str()))
+        {
+            compression = tp->method;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void
+srecord::output_file::compression_open()
+{
+    compression_checked = true;
+    FILE *fp = (FILE *)vfp;
+    switch (compression_guess())
+    {
+    case compression_auto:
+    case compression_none:
+        return;
+
+    case compression_gzip:
+        compression_engine = compressor_gzip::create(fp, *this);
+        break;
+
+    case compression_zstd:
+        compression_engine = compressor_zstd::create(fp, *this);
+        break;
+    }
+
+    //
+    // Compressed output can only be written front to back, so treat it
+    // like a pipe: holes are padded, backwards seeks are errors.
+    //
+    is_regular = false;
+    compression_block_size = compression_engine->preferred_block_size();
+    compression_buffer.reserve(compression_block_size);
+}
+
+
+void
+srecord::output_file::compression_flush()
+{
+    if (compression_buffer.empty())
+        return;
+    compression_engine->write
+    (
+        compression_buffer.data(),
+        compression_buffer.size()
+    );
+    compression_buffer.clear();
+}
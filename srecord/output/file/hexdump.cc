@@ -155,6 +155,20 @@ srecord::output_file_hexdump::write(const srecord::record &record)
 }
 
 
+void
+srecord::output_file_hexdump::write_data(uint32_t address, const void *data,
+    size_t length)
+{
+    //
+    // The row cache does all the formatting, there is no need to build
+    // intermediate data records.
+    //
+    const auto *dp = (const uint8_t *)data;
+    for (size_t j = 0; j < length; ++j)
+        emit_byte(address + j, dp[j]);
+}
+
+
 int
 srecord::output_file_hexdump::columns_to_line_length(int cols) const
 {
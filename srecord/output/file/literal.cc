@@ -0,0 +1,124 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#include <cstring>
+
+#include <srecord/output/file/literal.h>
+
+
+srecord::output_file_literal::output_file_literal(
+        const std::string &a_file_name) :
+    output_file(a_file_name)
+{
+}
+
+
+void
+srecord::output_file_literal::line_length_set(int n)
+{
+    line_length = n;
+}
+
+
+void
+srecord::output_file_literal::notify_layout(const interval &extents)
+{
+    range = extents;
+    range_given = true;
+}
+
+
+void
+srecord::output_file_literal::emit_literal(const char *start,
+    const char *between, const char *after, const char *text, size_t len)
+{
+    size_t between_len = strlen(between);
+    size_t after_len = strlen(after);
+    if (column && column + between_len + len + after_len > (size_t)line_length)
+    {
+        row += '\n';
+        column = 0;
+
+        //
+        // Hand the text over a few rows at a time; going any finer
+        // than this gains nothing and costs one write per row.
+        //
+        if (row.size() >= 4096)
+            row_flush();
+    }
+    if (!column)
+    {
+        row += start;
+        column = strlen(start);
+    }
+    else
+    {
+        row += between;
+        column += between_len;
+    }
+    row.append(text, len);
+    row += after;
+    column += len + after_len;
+}
+
+
+void
+srecord::output_file_literal::row_flush()
+{
+    put_bytes(row.data(), row.size());
+    row.clear();
+}
+
+
+void
+srecord::output_file_literal::range_add(interval::data_t lo,
+    interval::data_t hi)
+{
+    if (lo == hi)
+        return;
+    range_written = true;
+    if (range_given)
+        return;
+    if (range_run_lo != range_run_hi && lo == range_run_hi)
+    {
+        range_run_hi = hi;
+        return;
+    }
+    range_flush();
+    range_run_lo = lo;
+    range_run_hi = hi;
+}
+
+
+void
+srecord::output_file_literal::range_flush()
+{
+    if (range_run_lo != range_run_hi)
+        range += interval(range_run_lo, range_run_hi);
+    range_run_lo = 0;
+    range_run_hi = 0;
+}
+
+
+bool
+srecord::output_file_literal::range_empty()
+    const
+{
+    return !range_written;
+}
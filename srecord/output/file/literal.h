@@ -0,0 +1,185 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see
+// <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRECORD_OUTPUT_FILE_LITERAL_H
+#define SRECORD_OUTPUT_FILE_LITERAL_H
+
+#include <string>
+
+#include <srecord/interval.h>
+#include <srecord/output/file.h>
+
+namespace srecord
+{
+
+/**
+  * The srecord::output_file_literal class is used to represent the
+  * common parts of output files which render the data as rows of
+  * integer literals (see srecord/literal.h), such as C arrays and
+  * assembler data directives.  It accumulates the text a row at a
+  * time, and keeps track of the address range written.
+  */
+class output_file_literal:
+    public output_file
+{
+public:
+    /**
+      * The destructor.
+      */
+    ~output_file_literal() override = default;
+
+protected:
+    /**
+      * The constructor.  May only be called by derived classes.
+      *
+      * @param file_name
+      *     The name of the file to be written.
+      */
+    output_file_literal(const std::string &file_name);
+
+    // See base class for documentation.
+    void line_length_set(int) override;
+
+    // See base class for documentation.
+    void notify_layout(const interval &extents) override;
+
+    /**
+      * The emit_literal method is used to append a single value to
+      * the #row, starting a new line when it would not fit.  It uses
+      * #column to track the position, so as not to exceed
+      * #line_length.
+      *
+      * @param start
+      *     The text which starts each line, before the first value.
+      * @param between
+      *     The text which separates values on the same line.
+      * @param after
+      *     The text which follows every value.
+      * @param text
+      *     The text of the value, not NUL terminated.
+      * @param len
+      *     The length of the text.
+      */
+    void emit_literal(const char *start, const char *between,
+        const char *after, const char *text, size_t len);
+
+    /**
+      * The row_flush method is used to write any accumulated #row
+      * text to the output.
+      */
+    void row_flush();
+
+    /**
+      * The range_add method is used to note that the given address
+      * range is present in the output.
+      *
+      * @param lo
+      *     The lowest address of the data.
+      * @param hi
+      *     One past the highest address of the data.
+      */
+    void range_add(interval::data_t lo, interval::data_t hi);
+
+    /**
+      * The range_flush method is used to merge the pending run into
+      * #range.  It must be called before #range is consulted.
+      */
+    void range_flush();
+
+    /**
+      * The range_empty method is used to determine whether or not any
+      * data has been written yet.
+      */
+    bool range_empty() const;
+
+    /**
+      * The range instance variable is used to remember the range
+      * of addresses present in the output.
+      */
+    interval range;
+
+    /**
+      * The row instance variable is used to accumulate the text of
+      * the data, so that it is written in whole rows rather than one
+      * character at a time.
+      */
+    std::string row;
+
+    /**
+      * The column instance variable is used to remember the current
+      * printing column on the line.
+      */
+    int column{0};
+
+    /**
+      * The line_length instance variable is used to remember the
+      * maximum length of text lines.
+      */
+    int line_length{75};
+
+private:
+    /**
+      * The range_run_lo instance variable is used to remember the
+      * lowest address of the contiguous run of data most recently
+      * written, which has not yet been merged into #range.
+      */
+    interval::data_t range_run_lo{0};
+
+    /**
+      * The range_run_hi instance variable is used to remember the
+      * upper bound of the contiguous run of data most recently
+      * written, which has not yet been merged into #range.  Records
+      * usually arrive in ascending order, so the run simply grows,
+      * rather than rebuilding #range for every record.
+      */
+    interval::data_t range_run_hi{0};
+
+    /**
+      * The range_given instance variable is used to remember whether
+      * #range was supplied up front, by the #notify_layout method, in
+      * which case it need not be accumulated as the data is written.
+      */
+    bool range_given{false};
+
+    /**
+      * The range_written instance variable is used to remember whether
+      * or not any data has been written yet.
+      */
+    bool range_written{false};
+
+public:
+    /**
+      * The default constructor.
+      */
+    output_file_literal() = delete;
+
+    /**
+      * The copy constructor.
+      */
+    output_file_literal(const output_file_literal &) = delete;
+
+    /**
+      * The assignment operator.
+      */
+    output_file_literal &operator=(const output_file_literal &) = delete;
+};
+
+};
+
+#endif // SRECORD_OUTPUT_FILE_LITERAL_H
@@ -32,6 +32,14 @@ srecord::output_filter::write(const record &r)
 }
 
 
+void
+srecord::output_filter::write_data(uint32_t address, const void *data,
+    size_t length)
+{
+    deeper->write_data(address, data, length);
+}
+
+
 void
 srecord::output_filter::line_length_set(int n)
 {
@@ -84,6 +92,13 @@ srecord::output_filter::notify_upper_bound(uint32_t addr)
 }
 
 
+void
+srecord::output_filter::notify_layout(const interval &extents)
+{
+    deeper->notify_layout(extents);
+}
+
+
 void
 srecord::output_filter::command_line(arglex_tool *cmdln)
 {
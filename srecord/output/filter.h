@@ -50,6 +50,10 @@ class output_filter:
     // See base class for documentation.
     void write(const record &r) override;
 
+    // See base class for documentation.
+    void write_data(uint32_t address, const void *data, size_t length)
+        override;
+
     // See base class for documentation.
     void line_length_set(int) override;
 
@@ -71,6 +75,9 @@ class output_filter:
     // See base class for documentation.
     void notify_upper_bound(uint32_t addr) override;
 
+    // See base class for documentation.
+    void notify_layout(const interval &extents) override;
+
     // See base class for documentation.
     void command_line(arglex_tool *cmdln) override;
 
@@ -138,6 +138,19 @@ srecord::output_filter_reblock::write(const record &r)
 }
 
 
+void
+srecord::output_filter_reblock::write_data(uint32_t address,
+    const void *data, size_t length)
+{
+    //
+    // The data must pass through our own #write method to be
+    // re-blocked, so don't let the output_filter base class forward
+    // it straight to the deeper output.
+    //
+    output::write_data(address, data, length);
+}
+
+
 void
 srecord::output_filter_reblock::flush_buffer(bool partial)
 {
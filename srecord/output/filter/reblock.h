@@ -29,7 +29,9 @@ namespace srecord {
   * format's preferred block size.
   *
   * This can also be used to remove artifacts of whatever the SRecord
-  * internal memory chunk size happens to be.
+  * internal memory chunk size happens to be.  When the data comes from a
+  * srecord::memory image, srecord::memory_walker_reblock does the same
+  * job without copying every byte.
   */
 class output_filter_reblock:
     public output_filter
@@ -59,6 +61,10 @@ class output_filter_reblock:
     // See base class for documentation.
     void write(const record &r) override;
 
+    // See base class for documentation.
+    void write_data(uint32_t address, const void *data, size_t length)
+        override;
+
     // See base class for documentation.
     void line_length_set(int) override;
 
@@ -167,6 +167,15 @@ class record
       */
     const data_t *get_data() const { return data; }
 
+    /**
+      * The get_data method is used to get a pointer to the base of
+      * the record data, so that it may be modified in place.
+      *
+      * Note: Accessing beyond get_length() bytes will give an
+      * undefined value.
+      */
+    data_t *get_data() { return data; }
+
     /**
       * The get_data method is used to fetch the nth data value.
       *
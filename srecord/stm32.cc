@@ -26,6 +26,7 @@
 //
 
 #include <iostream>
+#include <srecord/crc_combine.h>
 #include <srecord/stm32.h>
 
 //
@@ -66,18 +67,123 @@ srecord::stm32::operator=(const stm32 &arg)
 
 //
 // The STM32 hardware CRC calculation uses CRC polynomial 0x04C11DB7
-// and operates only on words.
+// and operates only on words.  Each word is fed in most significant
+// bit first, which is the same as a byte-wise non-reflected CRC over
+// the word's bytes in big-endian order; so the usual table-driven
+// approach works, one table lookup per byte.
 //
-static uint32_t
+// The table has sixteen rows: table[k][b] is byte value b times
+// x^(32 + 8k), modulo the polynomial.  One word takes rows 0 to 3; four
+// words at a time take all sixteen rows, with sixteen independent
+// lookups instead of four dependent rounds.
+//
+// The table is built the first time it is asked for.  Being a function
+// local static, that happens exactly once, even when the first callers
+// are the threads of memory::walk_parallel.
+//
+
+struct stm32_table
+{
+    stm32_table();
+
+    uint32_t row[16][256];
+};
+
+
+stm32_table::stm32_table()
+{
+    for (unsigned b = 0; b < 256; ++b)
+    {
+        uint32_t v = b << 24;
+        for (int j = 0; j < 8; ++j)
+            v = (v & 0x80000000) ? ((v << 1) ^ POLYNOMIAL) : (v << 1);
+        row[0][b] = v;
+    }
+    for (unsigned k = 1; k < 16; ++k)
+    {
+        for (unsigned b = 0; b < 256; ++b)
+        {
+            uint32_t v = row[k - 1][b];
+            row[k][b] = (v << 8) ^ row[0][v >> 24];
+        }
+    }
+}
+
+
+static const uint32_t (*
+get_table())[256]
+{
+    static const stm32_table table;
+    return table.row;
+}
+
+
+static inline uint32_t
+load_le32(const uint8_t *p)
+{
+    return
+        (
+            (uint32_t)p[0]
+        |
+            ((uint32_t)p[1] << 8)
+        |
+            ((uint32_t)p[2] << 16)
+        |
+            ((uint32_t)p[3] << 24)
+        );
+}
+
+
+static inline uint32_t
 stm32_crc(uint32_t crc, uint32_t data)
 {
+    const uint32_t (*table)[256] = get_table();
     crc ^= data;
-    for (int j = 0; j < 32; ++j)
+    return
+        table[3][crc >> 24] ^ table[2][(crc >> 16) & 0xFF]
+    ^
+        table[1][(crc >> 8) & 0xFF] ^ table[0][crc & 0xFF];
+}
+
+
+/**
+  * The stm32_crc_words function is used to advance the CRC over a
+  * series of whole words, four at a time where possible.
+  */
+static uint32_t
+stm32_crc_words(uint32_t crc, const uint8_t *dp, size_t nwords)
+{
+    const uint32_t (*table)[256] = get_table();
+    while (nwords >= 4)
     {
-        if (crc & 0x80000000)
-            crc = (crc << 1) ^ POLYNOMIAL;
-        else
-            crc = (crc << 1);
+        uint32_t a = crc ^ load_le32(dp);
+        uint32_t b = load_le32(dp + 4);
+        uint32_t c = load_le32(dp + 8);
+        uint32_t d = load_le32(dp + 12);
+        crc =
+            table[15][a >> 24] ^ table[14][(a >> 16) & 0xFF]
+        ^
+            table[13][(a >> 8) & 0xFF] ^ table[12][a & 0xFF]
+        ^
+            table[11][b >> 24] ^ table[10][(b >> 16) & 0xFF]
+        ^
+            table[9][(b >> 8) & 0xFF] ^ table[8][b & 0xFF]
+        ^
+            table[7][c >> 24] ^ table[6][(c >> 16) & 0xFF]
+        ^
+            table[5][(c >> 8) & 0xFF] ^ table[4][c & 0xFF]
+        ^
+            table[3][d >> 24] ^ table[2][(d >> 16) & 0xFF]
+        ^
+            table[1][(d >> 8) & 0xFF] ^ table[0][d & 0xFF];
+        dp += 16;
+        nwords -= 4;
+    }
+    while (nwords > 0)
+    {
+        crc = stm32_crc(crc, load_le32(dp));
+        dp += 4;
+        --nwords;
     }
     return crc;
 }
@@ -86,10 +192,7 @@ stm32_crc(uint32_t crc, uint32_t data)
 void
 srecord::stm32::generator()
 {
-    uint32_t data = 0;
-    for (size_t j = 0; j < wordsize; j++)
-        data |= (buf[j] << (8 * j));
-    state = stm32_crc(state, data);
+    state = stm32_crc(state, load_le32(buf));
     cnt = 0;
 }
 
@@ -107,6 +210,31 @@ void
 srecord::stm32::nextbuf(const void *data, size_t nbytes)
 {
     const auto *dp = (const uint8_t *)data;
+
+    //
+    // Finish off any word left over from last time.
+    //
+    while (cnt > 0 && nbytes > 0)
+    {
+        --nbytes;
+        next(*dp++);
+    }
+
+    //
+    // Then as many whole words as there are, straight from the
+    // caller's buffer.
+    //
+    size_t nwords = nbytes / wordsize;
+    if (nwords > 0)
+    {
+        state = stm32_crc_words(state, dp, nwords);
+        dp += nwords * wordsize;
+        nbytes -= nwords * wordsize;
+    }
+
+    //
+    // Keep the rest for next time.
+    //
     while (nbytes > 0)
     {
         --nbytes;
@@ -115,6 +243,33 @@ srecord::stm32::nextbuf(const void *data, size_t nbytes)
 }
 
 
+void
+srecord::stm32::clear()
+{
+    state = 0;
+    cnt = 0;
+}
+
+
+void
+srecord::stm32::combine(const stm32 &later, size_t nbytes)
+{
+    // Only the whole words have reached the state, any partial word
+    // left over in later is still to come.
+    state =
+        crc_combine
+        (
+            state,
+            later.state,
+            nbytes - later.cnt,
+            POLYNOMIAL,
+            32
+        );
+    for (cnt = 0; cnt < later.cnt; ++cnt)
+        buf[cnt] = later.buf[cnt];
+}
+
+
 uint32_t
 srecord::stm32::get()
     const
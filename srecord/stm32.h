@@ -79,6 +79,26 @@ class stm32
       */
     void nextbuf(const void *data, size_t data_size);
 
+    /**
+      * The clear method is used to zero the running state, rather than
+      * seed it, so that this instance can work out a slice of the data
+      * for the #combine method.
+      */
+    void clear();
+
+    /**
+      * The combine method is used to advance the state as if the bytes
+      * of a later slice had been passed to #nextbuf.
+      *
+      * @param later
+      *     The checksum of the bytes immediately following those seen
+      *     so far, started with the #clear method.
+      * @param nbytes
+      *     The number of bytes seen by later.  The bytes seen so far
+      *     must be a whole number of words.
+      */
+    void combine(const stm32 &later, size_t nbytes);
+
     /**
       * Word size on the STM32
       */
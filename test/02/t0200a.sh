@@ -17,7 +17,7 @@
 # along with this program. If not, see <http://www.gnu.org/licenses/>.
 #
 
-TEST_SUBJECT="srecord::output_filter_reblock"
+TEST_SUBJECT="srecord::memory_walker_reblock"
 . test_prelude.sh
 
 # Note: the position of this data depends on srecord::memory_chunk::size
@@ -0,0 +1,86 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="C and asm decimal words"
+. test_prelude.sh
+
+cat > test.in << 'fubar'
+S00600004844521B
+S1110000000A0B646500FF09636364FFFF10D0
+S10B0014FFFF0000E8030900EE
+S5030002FA
+S9030000FC
+fubar
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+/* HDR */
+const unsigned short eprom[] =
+{
+2560, 25611, 101, 2559, 25443,
+65380, 4351, 65535, 65535,
+65535, 65535, 0, 1000, 9,
+};
+const unsigned long eprom_termination = 0;
+const unsigned long eprom_start       = 0;
+const unsigned long eprom_finish      = 28;
+const unsigned long eprom_length      = 28;
+
+#define EPROM_TERMINATION 0
+#define EPROM_START       0
+#define EPROM_FINISH      28
+#define EPROM_LENGTH      28
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.in -o test.out -c-array -decimal-style -output-word \
+    -line-length 30
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+cat > test.ok << 'fubar'
+; HDR
+        DW      2560,25611,101
+        DW      2559,25443
+        DW      65380,4351
+; To avoid this next ORG directive, use the --fill filter.
+        ORG     20
+        DW      65535,0,1000,9
+; execution start address = 0x0000
+; upper bound = 0x001C
+; lower bound = 0x0000
+; length =      0x001C
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.in -o test.out -asm -decimal-style -output-word \
+    -line-length 30
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
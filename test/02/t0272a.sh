@@ -0,0 +1,126 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="gzip compressed output"
+. test_prelude.sh
+
+cat > test.in << 'fubar'
+S00600004844521B
+S1130000000102030405060708090A0B0C0D0E0F74
+S1130020101112131415161718191A1B1C1D1E1F54
+S5030002FA
+S9030000FC
+fubar
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+S00600004844521B
+S1130000000102030405060708090A0B0C0D0E0F74
+S1130020101112131415161718191A1B1C1D1E1F54
+S5030002FA
+S9030000FC
+fubar
+if test $? -ne 0; then no_result; fi
+
+cat > ok2 << 'fubar'
+srec_cat: zlib not available
+fubar
+if test $? -ne 0; then no_result; fi
+
+# the suffix selects the compression
+srec_cat test.in -o test.out.gz > LOG 2>&1
+if test $? -ne 0; then
+    # if zlib not available, pass by default
+    if diff ok2 LOG > /dev/null 2> /dev/null; then
+        echo
+        echo "    SRecord appears to have been compiled without the zlib"
+        echo "    library, this test is therefore declared to pass by default."
+        echo
+        pass
+    fi
+
+    # some other error
+    cat LOG
+    fail
+fi
+
+gzip -dc < test.out.gz > test.out
+if test $? -ne 0; then no_result; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+# the option overrides the suffix, and holes are padded
+srec_cat test.in -o test.out.bin -binary -output-compression=gzip
+if test $? -ne 0; then fail; fi
+
+srec_cat test.in -o test.ok.bin -binary
+if test $? -ne 0; then fail; fi
+
+gzip -dc < test.out.bin > test.out
+if test $? -ne 0; then no_result; fi
+
+cmp test.ok.bin test.out
+if test $? -ne 0; then fail; fi
+
+# data which starts above address zero
+srec_cat -gen 0x100 0x110 -const 0x41 -o test.high.srec
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.high.srec -o test.out.bin.gz -binary
+if test $? -ne 0; then fail; fi
+
+srec_cat test.high.srec -o test.ok.bin -binary
+if test $? -ne 0; then fail; fi
+
+gzip -dc < test.out.bin.gz > test.out
+if test $? -ne 0; then fail; fi
+
+cmp test.ok.bin test.out
+if test $? -ne 0; then fail; fi
+
+# a leading hole, followed by more data beyond a second hole
+srec_cat -gen 0x1000 0x1010 -const 0x42 -gen 0x1400 0x1404 -const 0x43 \
+    -o test.hole.srec
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.hole.srec -o test.out.bin.gz -binary
+if test $? -ne 0; then fail; fi
+
+srec_cat test.hole.srec -o test.ok.bin -binary
+if test $? -ne 0; then fail; fi
+
+gzip -dc < test.out.bin.gz > test.out
+if test $? -ne 0; then fail; fi
+
+cmp test.ok.bin test.out
+if test $? -ne 0; then fail; fi
+
+# and "none" turns it off
+srec_cat test.in -o test.out.gz -output-compression=none
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out.gz
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,77 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="byte transform filters"
+. test_prelude.sh
+
+#
+# The filters transform whole records at a time, using vector
+# instructions where available.  Records of one byte can only take the
+# plain code path, so the long and short record versions of the same
+# data must give the same results.
+#
+srec_cat -generate 0 0x1000 -repeat-data 0 1 2 3 4 5 6 7 8 9 10 11 12 \
+    0x5A 0xA5 0x0F 0xF0 0x80 0x01 0x7F 0xFE 0xFF 0x3C 0xC3 0x81 \
+    -o long.srec -output-block-size=250 -esa 0
+if test $? -ne 0; then no_result; fi
+
+srec_cat long.srec -o short.srec -output-block-size=1
+if test $? -ne 0; then no_result; fi
+
+for filter in "-and 0x5A" "-or 0xA5" "-xor 0x3C" "-not" "-bit-reverse" \
+    "-nibble-swap"
+do
+    srec_cat long.srec $filter -o test.ok
+    if test $? -ne 0; then fail; fi
+
+    srec_cat short.srec $filter -o test.out
+    if test $? -ne 0; then fail; fi
+
+    diff test.ok test.out
+    if test $? -ne 0; then fail; fi
+done
+
+# and some known values
+cat > test.in << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S1230000000102030405060708090A0B0C0D0E0FF0E1D2C3B4A5968778695A4B3C2D1E0F6C
+S5030001FB
+S9030000FC
+fubar
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S1230000008040C020A060E0109050D030B070F00F874BC32DA569E11E965AD23CB478F064
+S5030001FB
+S9030000FC
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.in -bit-reverse -o test.out -output-block-size=32
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
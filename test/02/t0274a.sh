@@ -0,0 +1,72 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="filter chain fusion"
+. test_prelude.sh
+
+#
+# Adjacent offset, crop, exclude and byte-wise filters are fused into a
+# single stage.  Running each filter in a separate srec_cat process
+# can't be fused, so it must give the same answer.
+#
+srec_cat -generate 0 0x1000 -repeat-data 0 1 2 3 4 5 6 7 8 9 10 11 12 \
+    0x5A 0xA5 0x0F 0xF0 0x80 0x01 0x7F 0xFE 0xFF 0x3C 0xC3 0x81 \
+    -o test.in -output-block-size=250 -esa 0x280
+if test $? -ne 0; then no_result; fi
+
+cp test.in test.ok
+for filter in "-offset 0x100" "-crop 0x180 0x900" "-xor 0x5A" \
+    "-exclude 0x300 0x340" "-and 0x7F" "-not" "-bit-reverse" \
+    "-offset -0x80"
+do
+    srec_cat test.ok $filter -o test.tmp -output-block-size=250
+    if test $? -ne 0; then no_result; fi
+    mv test.tmp test.ok
+done
+
+srec_cat test.in -offset 0x100 -crop 0x180 0x900 -xor 0x5A \
+    -exclude 0x300 0x340 -and 0x7F -not -bit-reverse -offset -0x80 \
+    -o test.out -output-block-size=250
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# Check the plan.
+#
+cat > test.ok << 'fubar'
+srec_cat: filter plan:
+    fused: offset 0x100, xor 0x5A, and 0x7F, crop (0x0000 - 0x01FF) => offset 0x100, crop (0x0000 - 0x01FF), and 0x7F, xor 0x5A
+    Motorola S-Record: test.in
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat -filter-plan -disable-sequence-warnings test.in -offset 0x100 \
+    -xor 0x5A -and 0x7F -crop 0 0x200 -o test.tmp 2> test.out
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
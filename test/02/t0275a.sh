@@ -0,0 +1,90 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="catenate and merge"
+. test_prelude.sh
+
+#
+# Interleaved inputs give the same result whether they are read one
+# after the other, in nested groups, or merged by address.
+#
+srec_cat -generate 0 0x10 -repeat-data 1 -generate 0x30 0x40 -repeat-data 1 \
+    -o test.in1 -obs=16
+if test $? -ne 0; then no_result; fi
+
+srec_cat -generate 0x10 0x20 -repeat-data 2 -generate 0x40 0x50 \
+    -repeat-data 2 -o test.in2 -obs=16
+if test $? -ne 0; then no_result; fi
+
+srec_cat -generate 0x20 0x30 -repeat-data 3 -generate 0x50 0x60 \
+    -repeat-data 3 -o test.in3 -obs=16
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S12300000101010101010101010101010101010102020202020202020202020202020202AC
+S123002003030303030303030303030303030303010101010101010101010101010101017C
+S123004002020202020202020202020202020202030303030303030303030303030303034C
+S5030003F9
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.in1 test.in2 test.in3 -o test.out
+if test $? -ne 0; then fail; fi
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+srec_cat '(' test.in1 '(' test.in2 test.in3 ')' ')' -o test.out
+if test $? -ne 0; then fail; fi
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+srec_cat -merge test.in1 test.in2 test.in3 -o test.out
+if test $? -ne 0; then fail; fi
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# Merged inputs are read in address order, so where they contradict
+# each other it is the data at the higher address which is kept.
+#
+srec_cat -generate 0x10 0x20 -repeat-data 1 -o test.in1
+if test $? -ne 0; then no_result; fi
+
+srec_cat -generate 0 0x18 -repeat-data 2 -o test.in2
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S12300000202020202020202020202020202020201010101010101010101010101010101AC
+S5030001FB
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat -contradictory-bytes=warning -merge test.in1 test.in2 \
+    -o test.out 2> /dev/null
+if test $? -ne 0; then fail; fi
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
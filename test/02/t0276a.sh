@@ -0,0 +1,66 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="fill straight into memory"
+. test_prelude.sh
+
+#
+# When -fill is the last filter, the fill goes straight into memory.
+# With another filter after it, the fill is generated as records.
+# Both must give the same answer.
+#
+srec_cat -generate 0x100 0x200 -repeat-data 1 -generate 0x1FF0 0x2010 \
+    -repeat-data 2 -generate 0x3000 0x3001 -repeat-data 3 -o test.in
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.in -fill 0xFF 0xF0 0x4000 -o test.ok
+if test $? -ne 0; then fail; fi
+
+srec_cat '(' test.in -fill 0xFF 0xF0 0x4000 ')' -xor 0 -o test.out
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# A fill in the first of several inputs must still see the data of the
+# later inputs as contradictions.
+#
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S1130000FFFFFFFFFFFFFFFF0101010101010101EC
+S5030001FB
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat -generate 8 0x10 -repeat-data 1 -o test.in
+if test $? -ne 0; then no_result; fi
+
+srec_cat -generate 0 0x8 -repeat-data 0xFF -fill 0xFF 0 0x10 test.in \
+    -contradictory-bytes=warning -o test.out 2> /dev/null
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,76 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="generator blocks"
+. test_prelude.sh
+
+#
+# Generators fill whole records at a time.  Check the repeat pattern
+# lines up across holes in the range and across records.
+#
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S120000341424344454647414243444546474142434445464741424344454647412B
+S11501FE4445464741424344454647414243444546471D
+S5030002FA
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat -generate '(' 3 0x20 0x1FE 0x210 ')' -repeat-string ABCDEFG \
+    -o test.out -obs=32
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S11B00105A5A5A5A5A5A5A5A5A5A5A5A5A5A5A5A010203010203010225
+S5030001FB
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat -generate 0x10 0x20 -constant 0x5A -generate 0x20 0x28 \
+    -repeat-data 1 2 3 -o test.out -obs=32
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# Long runs are generated a record at a time; the pattern must carry on
+# from one record to the next.
+#
+srec_cat -generate 0 0x1000 -repeat-string ABCDEFG -o test.out -binary
+if test $? -ne 0; then fail; fi
+
+srec_cat -generate 0 0x1000 -repeat-string ABCDEFG -o test.in -obs=1
+if test $? -ne 0; then fail; fi
+
+srec_cat test.in -o test.ok -binary
+if test $? -ne 0; then fail; fi
+
+cmp test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,102 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="interval set arithmetic"
+. test_prelude.sh
+
+#
+# Records out of order, overlapping and abutting; the ranges must be
+# coalesced the same way however they arrive.
+#
+cat > test.in << 'fubar'
+S113030001010101010101010101010101010101D9
+S10B01000202020202020202E3
+S10B01080303030303030303D3
+S113020004040404040404040404040404040404AA
+S10B01040505050505050505C7
+fubar
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+Format: Motorola S-Record
+Data:   0100 - 010F (0010)
+        0200 - 020F (0010)
+        0300 - 030F (0010)
+Filled: 0030
+Allocated:   9.09%    Holes:  90.91%
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_info test.in -v > test.out 2> /dev/null
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+cat > test.ok << 'fubar'
+Format: Motorola S-Record
+Data:   0100 - 0101
+        0104 - 010F
+        0200 - 0207
+        020A - 020F
+        0300 - 0304
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_info test.in -exclude 0x102 0x104 0x208 0x20A -crop 0x100 0x305 \
+    > test.out 2> /dev/null
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# Punch holes, crop, and fill some of them back in again.
+#
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S10501000202F5
+S1230104050505050505050503030303FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFB7
+S1230124FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFD7
+S1230144FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFB7
+S1230164FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF97
+S1230184FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF77
+S12301A4FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF57
+S12301C4FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF37
+S12301E4FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF0404040403
+S107020404040404E2
+S109020A040404040404D2
+S10803000101010101EF
+S503000CF0
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat -multiple test.in -exclude 0x102 0x104 0x208 0x20A \
+    -crop 0x100 0x305 -fill 0xFF 0x108 0x200 -o test.out -obs=32 \
+    2> /dev/null
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
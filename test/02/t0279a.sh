@@ -0,0 +1,81 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="inputs named more than once"
+. test_prelude.sh
+
+#
+# The same file is used as the input, and again to work out the fill
+# range and an address.  It is parsed once and shared.
+#
+cat > test.in << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S10B00100101010101010101DC
+S107002002020202D0
+S5030002FA
+S9030010EC
+fubar
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S11700100101010101010101FFFFFFFFFFFFFFFF02020202D0
+S5030001FB
+S9030010EC
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.in -fill 0xFF -over test.in -crop 0 -max-addr test.in \
+    -o test.out -obs=32
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# Errors found when the records are replayed must still report where
+# in the file the record came from.
+#
+cat > test.in << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S10B00100101010101010101DC
+S107002002020202D0
+S10500120303E2
+S9030010EC
+fubar
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+srec_cat: test.in: 4: multiple 0x00000012 values (previous = 0x01, this one =
+    0x03)
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat -disable-sequence-warnings test.in -fill 0xFF -over test.in \
+    -o test.out > test.err 2>&1
+if test $? -ne 1; then fail; fi
+
+diff test.ok test.err
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="message filter hand over"
+. test_prelude.sh
+
+#
+# The message filters hand their buffer on a piece at a time; make
+# sure nothing is lost across the pieces of a larger image.
+#
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S208100000A144538C23
+S5030001FB
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat -generate 0 0x100000 -repeat-string 'Hello, World' \
+    -crc32-le 0x100000 -o test.bin -binary
+if test $? -ne 0; then fail; fi
+
+srec_cat test.bin -binary -crop 0x100000 0x100004 -o test.out
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+srec_cmp test.bin -binary -crop 0 0x100000 \
+    -generate 0 0x100000 -repeat-string 'Hello, World'
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,61 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="unfill runs"
+. test_prelude.sh
+
+#
+# Read a binary image in blocks and punch out the long runs of 0xFF.
+# Short runs stay in, and runs are not counted across records (the
+# binary input makes 255 byte records, so the run at 0x2FD is short).
+#
+srec_cat '(' -generate 0x10 0x14 -repeat-data 1 2 3 \
+    -generate 0x20 0x22 -repeat-data 0x41 0xFF \
+    -generate 0x120 0x200 -repeat-string ab \
+    -generate 0x2FE 0x2FF -constant 0 ')' -fill 0xFF 0 0x300 \
+    -o test.bin -binary
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S107001001020301E1
+S1040020419A
+S123012061626162616261626162616261626162616261626162616261626162616261628B
+S123014061626162616261626162616261626162616261626162616261626162616261626B
+S123016061626162616261626162616261626162616261626162616261626162616261624B
+S123018061626162616261626162616261626162616261626162616261626162616261622B
+S12301A061626162616261626162616261626162616261626162616261626162616261620B
+S12301C06162616261626162616261626162616261626162616261626162616261626162EB
+S12301E06162616261626162616261626162616261626162616261626162616261626162CB
+S10602FDFF00FFFC
+S503000AF2
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat test.bin -binary -unfill 0xFF 4 -o test.out -obs=32
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,65 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="crc32 block sizes"
+. test_prelude.sh
+
+#
+# The CRC32 is worked out sixteen, eight or one byte at a time, or by
+# the folding kernel for long runs.  Check lengths either side of each
+# block size, starting at an odd address, in both seed modes.
+#
+cat > test.ok << 'fubar'
+00010000: 34 8C 11 C3                                      #4..C
+00010000: EB 3D 70 2C                                      #k=p,
+00010000: BC 08 01 D2                                      #<..R
+00010000: 58 73 94 75                                      #Xs.u
+00010000: 91 94 68 30                                      #..h0
+00010000: D2 5A 9C 19                                      #RZ..
+00010000: 95 6F CF FC                                      #.oO|
+00010000: CA 41 38 1C                                      #JA8.
+00010000: 6B 9A DD B5                                      #k.]5
+00010000: 6A 6A E0 AD                                      #jj`-
+00010000: 15 CB 80 0D                                      #.K..
+00010000: 94 B6 DA 81                                      #.6Z.
+fubar
+if test $? -ne 0; then no_result; fi
+
+for n in 15 64 65 200 1900 5003
+do
+    srec_cat -generate 3 `expr 3 + $n` \
+        -repeat-string "The quick brown fox jumps over the lazy dog" \
+        -crc32-le 0x10000 -crop 0x10000 0x10004 -o - -hex-dump >> test.out
+    if test $? -ne 0; then fail; fi
+
+    srec_cat -generate 3 `expr 3 + $n` \
+        -repeat-string "The quick brown fox jumps over the lazy dog" \
+        -crc32-be 0x10000 -xmodem -crop 0x10000 0x10004 \
+        -o - -hex-dump >> test.out
+    if test $? -ne 0; then fail; fi
+done
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,112 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="crc models"
+. test_prelude.sh
+
+#
+# Each preset must give its catalogue check value, the CRC of the nine
+# ASCII digits "123456789".  Then a few custom models, including widths
+# which are not a whole number of bytes.
+#
+cat > test.in << 'fubar'
+S00600004844521B
+S10C000031323334353637383916
+S9030000FC
+fubar
+if test $? -ne 0; then no_result; fi
+
+cat > test.ok << 'fubar'
+00000100: F4                                               #t
+00000100: DF                                               #_
+00000100: A1                                               #!
+00000100: 4B                                               #K
+00000100: BB 3D                                            #;=
+00000100: 29 B1                                            #)1
+00000100: 90 6E                                            #.n
+00000100: 21 89                                            #!.
+00000100: 4B 37                                            #K7
+00000100: 31 C3                                            #1C
+00000100: CB F4 39 26                                      #Kt9&
+00000100: FC 89 19 18                                      #|...
+00000100: 76 5E 76 80                                      #v^v.
+00000100: 34 0B C6 D9                                      #4.FY
+00000100: 03 76 E6 E7                                      #.vfg
+00000100: E3 06 92 83                                      #c...
+00000100: 6C 40 DF 5F 0B 49 73 47                          #l@__.IsG
+00000100: B9 09 56 C7 75 A4 10 01                          #9.VGu$..
+00000100: 99 5D C9 BB DF 19 39 FA                          #.]I;_.9z
+00000100: 26 39 F4 CB                                      #&9tK
+00000100: 19                                               #.
+00000100: 06                                               #.
+00000100: 75                                               #u
+00000100: 0D AF                                            #./
+00000100: 21 CF 02                                         #!O.
+fubar
+if test $? -ne 0; then no_result; fi
+
+for model in crc-8 crc-8/autosar crc-8/maxim crc-8/sae-j1850 \
+    crc-16/arc crc-16/ibm-3740 crc-16/ibm-sdlc crc-16/kermit \
+    crc-16/modbus crc-16/xmodem crc-32 crc-32/bzip2 crc-32/cksum \
+    crc-32/jamcrc crc-32/mpeg-2 crc-32c crc-64/ecma-182 crc-64/go-iso \
+    crc-64/xz
+do
+    srec_cat test.in -crc-be 0x100 -model $model -crop 0x100 0x108 \
+        -o - -hex-dump >> test.out
+    if test $? -ne 0; then fail; fi
+done
+
+# the default is crc-32
+srec_cat test.in -crc-le 0x100 -crop 0x100 0x108 -o - -hex-dump >> test.out
+if test $? -ne 0; then fail; fi
+
+# CRC-5/USB
+srec_cat test.in -crc-be 0x100 -width 5 -poly 0x05 -init 0x1F \
+    -reflect-in -reflect-out -xor-out 0x1F -crop 0x100 0x108 \
+    -o - -hex-dump >> test.out
+if test $? -ne 0; then fail; fi
+
+# CRC-3/ROHC
+srec_cat test.in -crc-be 0x100 -width 3 -poly 3 -init 7 \
+    -reflect-in -reflect-out -crop 0x100 0x108 -o - -hex-dump >> test.out
+if test $? -ne 0; then fail; fi
+
+# CRC-7/MMC
+srec_cat test.in -crc-be 0x100 -width 7 -poly 9 -crop 0x100 0x108 \
+    -o - -hex-dump >> test.out
+if test $? -ne 0; then fail; fi
+
+# CRC-12/UMTS
+srec_cat test.in -crc-be 0x100 -width 12 -poly 0x80F -reflect-out \
+    -crop 0x100 0x108 -o - -hex-dump >> test.out
+if test $? -ne 0; then fail; fi
+
+# CRC-24/OPENPGP
+srec_cat test.in -crc-be 0x100 -width 24 -poly 0x864CFB -init 0xB704CE \
+    -crop 0x100 0x108 -o - -hex-dump >> test.out
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,54 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="stm32 word blocks"
+. test_prelude.sh
+
+#
+# The STM32 CRC is worked out four words at a time, then a word at a
+# time.  Check images of several sizes, so that both paths are used,
+# and the words run across the memory chunk boundaries.
+#
+cat > test.ok << 'fubar'
+00010000: 77 43 2B 0E                                      #wC+.
+00010000: 36 2C B4 00                                      #6,4.
+00010000: 0B 06 A7 79                                      #..'y
+00010000: 3F 71 4B 6B                                      #?qKk
+00010000: C4 AF E9 11                                      #D/i.
+fubar
+if test $? -ne 0; then no_result; fi
+
+for n in 12 64 100 1000 5004
+do
+    srec_cat '(' -generate 0 $n \
+        -repeat-string "The quick brown fox jumps over the lazy dog" \
+        -generate 0x2000 0x2048 -repeat-data 1 2 3 ')' \
+        -fill 0xFF 0 0x2048 -stm32-le 0x10000 -crop 0x10000 0x10004 \
+        -o - -hex-dump >> test.out
+    if test $? -ne 0; then fail; fi
+done
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,75 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="checksums in parallel"
+. test_prelude.sh
+
+#
+# Check that the checksums worked out a slice at a time, and put back
+# together, are the same as those worked out all in one go, however
+# many slices there are.
+#
+test_checksums -w > test.out
+if test $? -ne 0; then fail; fi
+
+#
+# And again, in a fresh process, so that the slices are the first to
+# need the STM32 lookup table.
+#
+test_checksums -c > test.out
+if test $? -ne 0; then fail; fi
+
+#
+# Check the answers are unchanged for an image big enough to be cut
+# into slices, with a hole in the middle, and an odd number of bytes
+# (for the whole words of the STM32 checksum).
+#
+srec_cat '(' -gen 0 0x180000 -rep-s "hello world" \
+    -gen 0x180010 0x300003 -rep-s "123456789" ')' \
+    -o test.in > log 2>&1
+if test $? -ne 0; then cat log; no_result; fi
+
+cat > test.ok << 'fubar'
+00400000: 61 8C A7 7F                                      #a.'.
+00400000: 77 65                                            #we
+00400000: CA 4D B6 65                                      #JM6e
+00400000: 27 09 BF 1D                                      #'.?.
+00400000: B9 99                                            #9.
+00400000: 56 6F                                            #Vo
+00400000: 31 3E F4 61                                      #1>ta
+fubar
+if test $? -ne 0; then no_result; fi
+
+rm -f test.out
+for filter in -crc32-b-e -crc16-b-e -stm32-b-e -adler32-b-e -adler16-b-e \
+    -fletcher16-b-e -fletcher32-b-e
+do
+    srec_cat test.in $filter 0x400000 -crop 0x400000 0x400010 \
+        -o - -hex-dump >> test.out 2> log
+    if test $? -ne 0; then cat log; fail; fi
+done
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,62 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="built in message digests"
+. test_prelude.sh
+
+#
+# MD5 and the SHA family are built in, so these work whether or not
+# libgcrypt was found.  1000 bytes is enough for several blocks, and a
+# partial block at the end.  The answers are the same as md5sum and
+# sha*sum give.
+#
+cat > test.ok << 'fubar'
+00001000: 72 31 1F 03 BF 0D 09 F6 46 24 B3 79 8E ED E1 37  #r1..?..vF$3y.ma7
+00001000: 61 F2 75 74 B4 65 7F C9 7B D3 1F F2 ED 0F 6C 55  #arut4e.I{S.rm.lU
+00001010: 8B 29 83 12                                      #.)..
+00001000: 61 C1 4E 25 24 1E B2 28 F9 05 A4 6F 5E 9D B5 99  #aAN%$.2(y.$o^.5.
+00001010: BF 26 3E 56 41 A5 43 EB F5 93 CE 3A              #?&>VA%Cku.N:
+00001000: 77 CF 3A EC A8 9F 62 E4 D0 88 AF F5 66 59 57 7B  #wO:l(.bdP./ufYW{
+00001010: 2D 0D 6B 6A 89 A6 8D 60 A4 A5 81 61 85 E3 E6 E0  #-.kj.&.`$%.a.cf`
+00001000: C8 94 90 F2 06 EA BB 59 FD 55 DB 94 AD 0D FE 19  #H..r.j;Y}U[.-.~.
+00001010: A6 CA F9 FF 24 51 F6 6E 02 30 B7 C1 9F A7 33 4C  #&Jy.$Qvn.07A.'3L
+00001020: 26 88 40 D3 7C 54 1E 90 26 06 49 87 B7 E0 AC D4  #&.@S|T..&.I.7`,T
+00001000: D6 33 D7 7A C9 F4 26 A8 27 3C C1 5A E0 38 55 01  #V3WzIt&('<AZ`8U.
+00001010: 1C EA 80 89 3C 97 15 94 85 3E 1C 02 58 04 66 18  #.j..<....>..X.f.
+00001020: 16 1F DD FC 5C 66 3F 92 67 27 65 44 3B 08 48 1F  #..]|\f?.g'eD;.H.
+00001030: 3B 74 4A AD F3 B9 68 52 1A 04 5A 24 37 24 59 6C  #;tJ-s9hR..Z$7$Yl
+fubar
+if test $? -ne 0; then no_result; fi
+
+rm -f test.out
+for digest in -md5 -sha1 -sha224 -sha256 -sha384 -sha512
+do
+    srec_cat -gen 0 1000 -rep-s "hello world" $digest 0x1000 \
+        -crop 0x1000 0x1040 -o - -hex-dump >> test.out 2> log
+    if test $? -ne 0; then cat log; fail; fi
+done
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,104 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="srec_info -digest"
+. test_prelude.sh
+
+cat > test.in << 'fubar'
+S00600004844521B
+S10B01000202020202020202E3
+S113030001010101010101010101010101010101D9
+S9030000FC
+fubar
+if test $? -ne 0; then no_result; fi
+
+#
+# Several digests, each input walked once, holes skipped.
+#
+cat > test.ok << 'fubar'
+
+test.in:
+Format: Motorola S-Record
+Header: "HDR"
+Execution Start Address: 00000000
+Data:   0100 - 0107
+        0300 - 030F
+CRC32: 8C71F5E0
+Adler16: ED21
+SHA1: 376162D96DDC543CD3CD3BA87597CF7250D92FF0
+crc-16/xmodem: C7C4
+MD5: E0F7CAD5B643A5784E0C74BEC41CDDF1
+
+constant 0x00:
+Format: constant
+Data:   0000 - 000F
+CRC32: ECBB4B55
+Adler16: 1001
+SHA1: E129F27C5103BC5CC44BCDF0A15E160D445066FF
+crc-16/xmodem: 0000
+MD5: 4AE71336E44BF9BF79D2752E234818A5
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_info test.in -gen 0 16 -const 0 -digest crc32 -dig adler16 -dig sha1 \
+    -dig CRC-16/XMODEM -dig md5 > test.out 2> /dev/null
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The same values as the filters give.
+#
+cat > test.ok << 'fubar'
+Format: Motorola S-Record
+Header: "HDR"
+Execution Start Address: 00000000
+Data:   0100 - 0107
+        0300 - 030F
+STM32: FF18A16B
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_info test.in -digest stm32 > test.out 2> /dev/null
+if test $? -ne 0; then fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+srec_cat test.in -stm32-be 0x1000 -crop 0x1000 0x1004 -o test.out -hex-dump \
+    2> /dev/null
+if test $? -ne 0; then fail; fi
+
+cat > test.ok << 'fubar'
+00001000: FF 18 A1 6B                                      #..!k
+fubar
+if test $? -ne 0; then no_result; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+srec_info test.in -digest no-such-thing > /dev/null 2>&1
+if test $? -ne 1; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
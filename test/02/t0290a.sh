@@ -0,0 +1,85 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="message filter pass through"
+. test_prelude.sh
+
+#
+# Data out of order, and with holes: the runs passed through and the
+# run held back must all be put back together in address order.
+#
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S12300002222222222222222222222222222222211111111111111111111111111111111AC
+S10B0028333333333333333334
+S1090040D640264A166DAD
+S5030003F9
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat '(' -gen 0x10 0x20 -const 0x11 -gen 0 0x10 -const 0x22 \
+    -gen 0x28 0x30 -const 0x33 ')' -crc32-le 0x40 -adler16-b-e 0x44 \
+    -o test.out > log 2>&1
+if test $? -ne 0; then cat log; fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# Data given again, after it has been passed through, can't replace
+# what was passed through; the checksum must agree with what was.
+#
+cat > test.ok << 'fubar'
+S0220000687474703A2F2F737265636F72642E736F75726365666F7267652E6E65742F1D
+S123000061626361626361626361626361626361626361626361626361626361626361629D
+S1070040E1171008A8
+S5030002FA
+fubar
+if test $? -ne 0; then no_result; fi
+
+srec_cat '(' -gen 0 0x20 -rep-s abc -gen 0x8 0xC -const 0x44 ')' \
+    -crc32-le 0x40 -o test.out > log 2>&1
+if test $? -ne 0; then cat log; fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# Larger runs, crossing memory chunk boundaries, in either order.
+#
+srec_cat '(' -gen 0x20000 0x38003 -rep-s "hello world" \
+    -gen 0 0x10001 -rep-s "123456789" ')' \
+    -crc32-le 0x100000 -fletcher32-le 0x100004 -crc16-le 0x100008 \
+    -o test.ok > log 2>&1
+if test $? -ne 0; then cat log; fail; fi
+
+srec_cat '(' -gen 0 0x10001 -rep-s "123456789" \
+    -gen 0x20000 0x38003 -rep-s "hello world" ')' \
+    -crc32-le 0x100000 -fletcher32-le 0x100004 -crc16-le 0x100008 \
+    -o test.out > log 2>&1
+if test $? -ne 0; then cat log; fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,89 @@
+#!/bin/sh
+#
+#       srecord - manipulate eprom load files
+#       Copyright (C) 2026 Scott Finneran
+#
+#       This program is free software; you can redistribute it and/or modify
+#       it under the terms of the GNU General Public License as published by
+#       the Free Software Foundation; either version 3 of the License, or
+#       (at your option) any later version.
+#
+#       This program is distributed in the hope that it will be useful,
+#       but WITHOUT ANY WARRANTY; without even the implied warranty of
+#       MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#       GNU General Public License for more details.
+#
+#       You should have received a copy of the GNU General Public License
+#       along with this program. If not, see
+#       <http://www.gnu.org/licenses/>.
+#
+TEST_SUBJECT="digests filter"
+. test_prelude.sh
+
+#
+# Some data, with a hole in it.
+#
+srec_cat -gen 0 0x100 -rep-s "hello world" -gen 0x200 0x280 -rep-s abc \
+    -o test.in > log 2>&1
+if test $? -ne 0; then cat log; no_result; fi
+
+#
+# All of the results from the one walk must be the same as those of
+# the separate filters, placed one after the other.
+#
+srec_cat \
+    test.in -crc32-b-e 0x1000 -crop 0x1000 0x1004 \
+    test.in -sha256 0x1004 -crop 0x1004 0x1024 \
+    test.in -adler16-b-e 0x1024 -crop 0x1024 0x1026 \
+    test.in -crc-b-e 0x1026 -model crc-16/xmodem -crop 0x1026 0x1028 \
+    -o test.ok > log 2>&1
+if test $? -ne 0; then cat log; no_result; fi
+
+srec_cat test.in -DIGESTS 0x1000 crc32,sha256,adler16,crc-16/xmodem \
+    -crop 0x1000 0x1028 -o test.out > log 2>&1
+if test $? -ne 0; then cat log; fail; fi
+
+diff test.ok test.out
+if test $? -ne 0; then fail; fi
+
+#
+# The data itself is passed through.
+#
+srec_cat test.in -DIGESTS 0x1000 crc32,sha256 -crop 0 0x1000 \
+    -o test.out > log 2>&1
+if test $? -ne 0; then cat log; fail; fi
+
+srec_cmp test.in test.out > log 2>&1
+if test $? -ne 0; then cat log; fail; fi
+
+#
+# More input files may follow the filter.
+#
+srec_cat test.in -DIGESTS 0x1000 crc32 test.in -offset 0x2000 \
+    -o test.out > log 2>&1
+if test $? -ne 0; then cat log; fail; fi
+
+#
+# Unknown names are an error, which lists all of the known names.
+#
+srec_cat test.in -DIGESTS 0x1000 crc32,bogus -o test.out > log 2>&1
+if test $? -eq 0; then fail; fi
+
+for name in Adler16 SHA256 crc-32c
+do
+    grep -- "$name" log > /dev/null
+    if test $? -ne 0; then cat log; fail; fi
+done
+
+#
+# Results which don't fit in a single record are an error.
+#
+srec_cat test.in -DIGESTS 0x1000 sha512,sha512,sha512,sha512 \
+    -o test.out > log 2>&1
+if test $? -eq 0; then fail; fi
+
+#
+# The things tested here, worked.
+# No other guarantees are made.
+#
+pass
@@ -0,0 +1,646 @@
+//
+// srecord - Manipulate EPROM load files
+// Copyright (C) 2026 Scott Finneran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <srecord/adler16.h>
+#include <srecord/adler32.h>
+#include <srecord/byte_sums.h>
+#include <srecord/fletcher16.h>
+#include <srecord/fletcher32.h>
+#include <srecord/memory.h>
+#include <srecord/memory/walker/adler16.h>
+#include <srecord/memory/walker/adler32.h>
+#include <srecord/memory/walker/crc16.h>
+#include <srecord/memory/walker/crc32.h>
+#include <srecord/memory/walker/crc_rocksoft.h>
+#include <srecord/memory/walker/fletcher16.h>
+#include <srecord/memory/walker/fletcher32.h>
+#include <srecord/memory/walker/multi.h>
+#include <srecord/memory/walker/stm32.h>
+#include <srecord/progname.h>
+
+//
+// The nextbuf methods of the Fletcher and Adler checksums work a block
+// at a time, and only reduce at the end of each block.  This checks
+// that they give exactly the same answers as the simple algorithms they
+// replaced, over a range of lengths, alignments and contents.  The
+// same goes for the lane sums of the positional -checksum filters.
+// All-zero and all-0xFF data are included, as they are where the two
+// representations of zero (modulo 255 or 65535) would show up.
+//
+// With the -w option, it instead checks that memory::walk_parallel
+// gives the same checksums as memory::walk, however many slices the
+// data is cut into, both alone and all together in a single walk, and
+// that memory::walk_incremental does too, before and after patching.
+//
+// With the -c option, it checks that walk_parallel gives the right
+// STM32 and CRC32 checksums when it is the first thing the process
+// does, so that the slices' threads are the first to need the lookup
+// tables.
+//
+
+
+static int errors;
+
+
+/**
+  * The next_random function is used to advance a simple linear
+  * congruential generator, so that the test data is the same every
+  * time.
+  *
+  * @param x
+  *     The state of the generator, updated.
+  */
+static uint32_t
+next_random(uint32_t &x)
+{
+    x = x * 1103515245 + 12345;
+    return x;
+}
+
+
+/**
+  * The fill_random function is used to fill a buffer with bytes from
+  * the #next_random generator.
+  *
+  * @param buffer
+  *     The buffer to be filled.
+  * @param x
+  *     The state of the generator, updated.
+  */
+static void
+fill_random(std::vector<unsigned char> &buffer, uint32_t &x)
+{
+    for (auto &c : buffer)
+        c = next_random(x) >> 24;
+}
+
+
+static uint16_t
+simple_adler16(const unsigned char *data, size_t len)
+{
+    unsigned a = 1;
+    unsigned b = 0;
+    for (size_t j = 0; j < len; ++j)
+    {
+        a = (a + data[j]) % 251;
+        b = (b + a) % 251;
+    }
+    return ((b << 8) | a);
+}
+
+
+static uint32_t
+simple_adler32(const unsigned char *data, size_t len)
+{
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (size_t j = 0; j < len; ++j)
+    {
+        a = (a + data[j]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return ((b << 16) | a);
+}
+
+
+//
+// These two are the end-around carry code, with the reduction every
+// 21 (or 360) bytes, which was used before.  (Not the next method,
+// which for Fletcher-16 can leave 0x100 in sum2.)
+//
+
+static uint16_t
+simple_fletcher16(uint8_t seed1, uint8_t seed2, const unsigned char *data,
+    size_t len)
+{
+    uint16_t sum1 = (seed1 == 0xFF ? 0 : seed1);
+    uint16_t sum2 = (seed2 == 0xFF ? 0 : seed2);
+    while (len)
+    {
+        size_t tlen = len > 21 ? 21 : len;
+        len -= tlen;
+        while (tlen--)
+        {
+            sum1 += *data++;
+            sum2 += sum1;
+        }
+        sum1 = (sum1 & 0xFF) + (sum1 >> 8);
+        sum2 = (sum2 & 0xFF) + (sum2 >> 8);
+    }
+    sum1 = (sum1 & 0xFF) + (sum1 >> 8);
+    sum2 = (sum2 & 0xFF) + (sum2 >> 8);
+    return (((sum1 & 0xFF) << 8) | (sum2 & 0xFF));
+}
+
+
+static uint32_t
+simple_fletcher32(const unsigned char *data, size_t len)
+{
+    uint32_t sum1 = 0xFFFF;
+    uint32_t sum2 = 0xFFFF;
+    while (len)
+    {
+        size_t tlen = len > 360 ? 360 : len;
+        len -= tlen;
+        while (tlen--)
+        {
+            sum1 += *data++;
+            sum2 += sum1;
+        }
+        sum1 = (sum1 & 0xFFFF) + (sum1 >> 16);
+        sum2 = (sum2 & 0xFFFF) + (sum2 >> 16);
+    }
+    sum1 = (sum1 & 0xFFFF) + (sum1 >> 16);
+    sum2 = (sum2 & 0xFFFF) + (sum2 >> 16);
+    return ((sum2 << 16) | sum1);
+}
+
+
+static void
+check(const char *name, const char *how, size_t offset, size_t len,
+    unsigned long actual, unsigned long expected)
+{
+    if (actual != expected)
+    {
+        fprintf
+        (
+            stderr,
+            "%s: %s: offset %d, length %d: gave 0x%08lX, expected 0x%08lX\n",
+            name,
+            how,
+            int(offset),
+            int(len),
+            actual,
+            expected
+        );
+        ++errors;
+    }
+}
+
+
+template <class checksum_t>
+static unsigned long
+by_nextbuf(checksum_t checksum, const unsigned char *data, size_t len)
+{
+    // split it, to check the state carries across calls
+    size_t part = len / 3;
+    checksum.nextbuf(data, part);
+    checksum.nextbuf(data + part, len - part);
+    return checksum.get();
+}
+
+
+template <class checksum_t>
+static unsigned long
+by_next(checksum_t checksum, const unsigned char *data, size_t len)
+{
+    for (size_t j = 0; j < len; ++j)
+        checksum.next(data[j]);
+    return checksum.get();
+}
+
+
+static void
+compare_all(const std::vector<unsigned char> &buffer, size_t offset,
+    size_t len)
+{
+    const unsigned char *data = &buffer[offset];
+
+    unsigned long expected = simple_adler16(data, len);
+    check("adler16", "nextbuf", offset, len,
+        by_nextbuf(srecord::adler16(), data, len), expected);
+    check("adler16", "next", offset, len,
+        by_next(srecord::adler16(), data, len), expected);
+
+    expected = simple_adler32(data, len);
+    check("adler32", "nextbuf", offset, len,
+        by_nextbuf(srecord::adler32(), data, len), expected);
+    check("adler32", "next", offset, len,
+        by_next(srecord::adler32(), data, len), expected);
+
+    check("fletcher32", "nextbuf", offset, len,
+        by_nextbuf(srecord::fletcher32(), data, len),
+        simple_fletcher32(data, len));
+
+    static const uint8_t seeds[] = { 0, 1, 0xFE, 0xFF };
+    for (uint8_t s1 : seeds)
+    {
+        for (uint8_t s2 : seeds)
+        {
+            check("fletcher16", "nextbuf", offset, len,
+                by_nextbuf(srecord::fletcher16(s1, s2), data, len),
+                simple_fletcher16(s1, s2, data, len));
+        }
+    }
+
+    for (unsigned width = 1; width <= 8; ++width)
+    {
+        uint32_t sums[8];
+        srecord::byte_lane_sums(data, len, width, sums);
+        for (unsigned k = 0; k < width; ++k)
+        {
+            uint32_t lane = 0;
+            for (size_t j = k; j < len; j += width)
+                lane += data[j];
+            check("byte_lane_sums", "lane", offset, len, sums[k], lane);
+        }
+    }
+}
+
+
+template <class factory_t>
+static void
+compare_walks(const char *name, const srecord::memory &mem,
+    srecord::memory &patched, factory_t create)
+{
+    auto w = create();
+    mem.walk(w);
+    unsigned long long expected = w->get();
+    for (unsigned nslices = 1; nslices < 10; ++nslices)
+    {
+        auto p = create();
+        mem.walk_parallel(p, nslices);
+        unsigned long long actual = p->get();
+        if (actual != expected)
+        {
+            fprintf
+            (
+                stderr,
+                "%s: %u slices: gave 0x%llX, expected 0x%llX\n",
+                name,
+                nslices,
+                actual,
+                expected
+            );
+            ++errors;
+        }
+    }
+
+    //
+    // Walking incrementally must give the same answers as walking from
+    // scratch: the first time, again with nothing changed, and again
+    // after a few bytes have been patched.  The patched copy is shared
+    // by all of the calculations, so that each one's summaries are
+    // kept alongside the others', and must not be mistaken for them.
+    //
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        if (pass == 2)
+        {
+            uint32_t lo = patched.get_lower_bound();
+            uint32_t hi = patched.get_upper_bound();
+            patched.set(lo, 0x5A);
+            patched.set(lo + (hi - lo) / 2, 0xA5);
+            patched.set(hi - 1, 0x3C);
+        }
+        auto p = create();
+        patched.walk_incremental(p);
+        auto q = create();
+        patched.walk(q);
+        if (p->get() != q->get())
+        {
+            fprintf
+            (
+                stderr,
+                "%s: incremental pass %d: gave 0x%llX, expected 0x%llX\n",
+                name,
+                pass,
+                (unsigned long long)p->get(),
+                (unsigned long long)q->get()
+            );
+            ++errors;
+        }
+    }
+}
+
+
+static void
+compare_walks_all(const srecord::memory &mem)
+{
+    srecord::memory patched(mem);
+    compare_walks("adler16", mem, patched,
+        [] { return srecord::memory_walker_adler16::create(); });
+    compare_walks("adler32", mem, patched,
+        [] { return srecord::memory_walker_adler32::create(); });
+    compare_walks("fletcher32", mem, patched,
+        [] { return srecord::memory_walker_fletcher32::create(); });
+    compare_walks("fletcher16", mem, patched,
+        []
+        {
+            return
+                srecord::memory_walker_fletcher16::create
+                (
+                    0,
+                    0,
+                    -1,
+                    srecord::endian_big
+                );
+        });
+    compare_walks("fletcher16 answer", mem, patched,
+        []
+        {
+            return
+                srecord::memory_walker_fletcher16::create
+                (
+                    0xFF,
+                    1,
+                    0,
+                    srecord::endian_little
+                );
+        });
+    compare_walks("stm32", mem, patched,
+        [] { return srecord::memory_walker_stm32::create(); });
+    compare_walks("crc32", mem, patched,
+        []
+        {
+            return
+                srecord::memory_walker_crc32::create
+                (
+                    srecord::crc32::seed_mode_ccitt
+                );
+        });
+    compare_walks("crc32 xmodem", mem, patched,
+        []
+        {
+            return
+                srecord::memory_walker_crc32::create
+                (
+                    srecord::crc32::seed_mode_xmodem
+                );
+        });
+
+    static const uint16_t polynomials[] = { 0x1021, 0x8005 };
+    for (uint16_t polynomial : polynomials)
+    {
+        for (int augment = 0; augment < 2; ++augment)
+        {
+            for (int reflect = 0; reflect < 2; ++reflect)
+            {
+                compare_walks("crc16", mem, patched,
+                    [=]
+                    {
+                        return
+                            srecord::memory_walker_crc16::create
+                            (
+                                srecord::crc16::seed_mode_ccitt,
+                                augment,
+                                polynomial,
+                                (
+                                    reflect
+                                ?
+                                    srecord::crc16::bit_direction_least_to_most
+                                :
+                                    srecord::crc16::bit_direction_most_to_least
+                                )
+                            );
+                    });
+            }
+        }
+    }
+
+    static const char *const models[] =
+    {
+        "crc-8",
+        "crc-8/maxim",
+        "crc-16/kermit",
+        "crc-16/xmodem",
+        "crc-32/bzip2",
+        "crc-32c",
+        "crc-64/ecma-182",
+        "crc-64/xz",
+    };
+    for (const char *name : models)
+    {
+        const srecord::crc_rocksoft::model &m =
+            srecord::crc_rocksoft::model_by_name(name);
+        compare_walks(name, mem, patched,
+            [&] { return srecord::memory_walker_crc_rocksoft::create(m); });
+    }
+}
+
+
+static void
+compare_multi(const srecord::memory &mem)
+{
+    auto adler = srecord::memory_walker_adler16::create();
+    mem.walk(adler);
+    auto crc = srecord::memory_walker_crc32::create(
+        srecord::crc32::seed_mode_ccitt);
+    mem.walk(crc);
+    auto stm = srecord::memory_walker_stm32::create();
+    mem.walk(stm);
+
+    for (unsigned nslices = 1; nslices < 10; ++nslices)
+    {
+        auto a = srecord::memory_walker_adler16::create();
+        auto c = srecord::memory_walker_crc32::create(
+            srecord::crc32::seed_mode_ccitt);
+        auto s = srecord::memory_walker_stm32::create();
+        auto w = srecord::memory_walker_multi::create();
+        w->push_back(a);
+        w->push_back(c);
+        w->push_back(s);
+        mem.walk_parallel(w, nslices);
+        if
+        (
+            a->get() != adler->get()
+        ||
+            c->get() != crc->get()
+        ||
+            s->get() != stm->get()
+        )
+        {
+            fprintf(stderr, "multi: %u slices: mismatch\n", nslices);
+            ++errors;
+        }
+    }
+
+    //
+    // The composite's summaries are kept under a key of their own, as
+    // well as the keys of the walkers it holds.
+    //
+    srecord::memory copy(mem);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        auto a = srecord::memory_walker_adler16::create();
+        auto c = srecord::memory_walker_crc32::create(
+            srecord::crc32::seed_mode_ccitt);
+        auto s = srecord::memory_walker_stm32::create();
+        auto w = srecord::memory_walker_multi::create();
+        w->push_back(a);
+        w->push_back(c);
+        w->push_back(s);
+        copy.walk_incremental(w);
+        if
+        (
+            a->get() != adler->get()
+        ||
+            c->get() != crc->get()
+        ||
+            s->get() != stm->get()
+        )
+        {
+            fprintf(stderr, "multi: incremental pass %d: mismatch\n", pass);
+            ++errors;
+        }
+    }
+}
+
+
+static void
+check_walks()
+{
+    //
+    // Runs of data of all sorts of lengths, some crossing chunk
+    // boundaries, with holes of all sorts of lengths between them.
+    //
+    uint32_t x = 1;
+    srecord::memory holey;
+    uint32_t address = 3;
+    for (int j = 0; j < 60; ++j)
+    {
+        std::vector<unsigned char> run((next_random(x) >> 16) % 3000);
+        fill_random(run, x);
+        for (unsigned char c : run)
+            holey.set(address++, c);
+        address += 1 + (next_random(x) >> 16) % 500;
+    }
+    compare_walks_all(holey);
+    compare_multi(holey);
+
+    //
+    // Too few bytes for some of the slices to have any.
+    //
+    srecord::memory sparse;
+    sparse.set(5, 0x12);
+    sparse.set(0x10000, 0x34);
+    sparse.set(0x10001, 0x56);
+    sparse.set(0x7FFFFFFF, 0x78);
+    sparse.set(0xFFFFFFFF, 0x9A);
+    compare_walks_all(sparse);
+    compare_multi(sparse);
+
+    srecord::memory empty;
+    compare_walks_all(empty);
+}
+
+
+static void
+check_cold()
+{
+    uint32_t x = 1;
+    std::vector<unsigned char> buffer(0x40000);
+    fill_random(buffer, x);
+    srecord::memory mem;
+    for (uint32_t address = 0; address < buffer.size(); ++address)
+        mem.set(address, buffer[address]);
+
+    // No slices, no threads, until now.
+    auto p = srecord::memory_walker_stm32::create();
+    mem.walk_parallel(p, 8);
+    auto q =
+        srecord::memory_walker_crc32::create(srecord::crc32::seed_mode_ccitt);
+    mem.walk_parallel(q, 8);
+
+    auto w = srecord::memory_walker_stm32::create();
+    mem.walk(w);
+    if (p->get() != w->get())
+    {
+        fprintf
+        (
+            stderr,
+            "stm32: cold 8 slices: gave 0x%X, expected 0x%X\n",
+            p->get(),
+            w->get()
+        );
+        ++errors;
+    }
+    auto c =
+        srecord::memory_walker_crc32::create(srecord::crc32::seed_mode_ccitt);
+    mem.walk(c);
+    if (q->get() != c->get())
+    {
+        fprintf
+        (
+            stderr,
+            "crc32: cold 8 slices: gave 0x%X, expected 0x%X\n",
+            q->get(),
+            c->get()
+        );
+        ++errors;
+    }
+}
+
+
+int
+main(int argc, char **argv)
+{
+    srecord::progname_set(argv[0]);
+    bool walks = (argc == 2 && 0 == strcmp(argv[1], "-w"));
+    bool cold = (argc == 2 && 0 == strcmp(argv[1], "-c"));
+    if (argc != 1 && !walks && !cold)
+    {
+        fprintf(stderr, "Usage: %s [ -c | -w ]\n", srecord::progname_get());
+        exit(1);
+    }
+    if (walks || cold)
+    {
+        if (walks)
+            check_walks();
+        else
+            check_cold();
+        if (errors)
+            return 1;
+        printf("ok\n");
+        return 0;
+    }
+
+    std::vector<unsigned char> buffer(10000);
+
+    uint32_t x = 1;
+    fill_random(buffer, x);
+    for (size_t offset = 0; offset < 4; ++offset)
+    {
+        for (size_t len = 0; len < 200; ++len)
+            compare_all(buffer, offset, len);
+    }
+    static const size_t long_lengths[] = { 4095, 4096, 4097, 8193, 9990 };
+    for (size_t len : long_lengths)
+        compare_all(buffer, 3, len);
+
+    static const unsigned char fills[] = { 0x00, 0xFF };
+    for (unsigned char fill : fills)
+    {
+        std::vector<unsigned char> same(buffer.size(), fill);
+        for (size_t len = 0; len < 100; ++len)
+            compare_all(same, 1, len);
+        for (size_t len : long_lengths)
+            compare_all(same, 0, len);
+    }
+
+    if (errors)
+        return 1;
+    printf("ok\n");
+    return 0;
+}
@@ -16,10 +16,12 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <unistd.h>
 #include <getopt.h>
+#include <vector>
 
 #include <srecord/bitrev.h>
 #include <srecord/crc16.h>
@@ -32,6 +34,9 @@ static void
 usage()
 {
     fprintf(stderr, "Usage: [ -av ] %s\n", srecord::progname_get());
+    fprintf(stderr, "       [ -av ] %s -k\n", srecord::progname_get());
+    fprintf(stderr, "       [ -av ] %s -B <megabytes>\n",
+        srecord::progname_get());
     exit(1);
 }
 
@@ -39,8 +44,10 @@ usage()
 static const struct option options[] =
 {
     { "augment", 0, 0, 'a' },
+    { "benchmark", 1, 0, 'B' },
     { "broken", 0, 0, 'b' },
     { "ccitt", 0, 0, 'c' },
+    { "check", 0, 0, 'k' },
     { "help", 0, 0, 'h' },
     { "polynomial", 1, 0, 'p' },
     { "reverse", 0, 0, 'r' },
@@ -50,6 +57,107 @@ static const struct option options[] =
 };
 
 
+/**
+  * The fill_random function is used to fill a buffer with bytes from a
+  * simple linear congruential generator, so that the test data is the
+  * same every time.
+  */
+static void
+fill_random(std::vector<unsigned char> &buffer)
+{
+    uint32_t x = 1;
+    for (auto &c : buffer)
+    {
+        x = x * 1103515245 + 12345;
+        c = x >> 24;
+    }
+}
+
+
+/**
+  * The check function is used to compare the multi-byte nextbuf
+  * method against feeding the same bytes one at a time, across a range
+  * of lengths and alignments.
+  */
+static int
+check(const srecord::crc16 &prototype)
+{
+    std::vector<unsigned char> buffer(600);
+    fill_random(buffer);
+    for (size_t offset = 0; offset < 8; ++offset)
+    {
+        for (size_t len = 0; len + offset <= buffer.size(); ++len)
+        {
+            srecord::crc16 slow(prototype);
+            for (size_t j = 0; j < len; ++j)
+                slow.next(buffer[offset + j]);
+
+            // split it in two, to check the state carries across calls
+            srecord::crc16 fast(prototype);
+            size_t half = len / 3;
+            fast.nextbuf(&buffer[offset], half);
+            fast.nextbuf(&buffer[offset + half], len - half);
+
+            if (slow.get() != fast.get())
+            {
+                fprintf
+                (
+                    stderr,
+                    "offset %d, length %d: nextbuf gave 0x%04X, "
+                        "next gave 0x%04X\n",
+                    int(offset),
+                    int(len),
+                    fast.get(),
+                    slow.get()
+                );
+                return 1;
+            }
+        }
+    }
+    printf("ok\n");
+    return 0;
+}
+
+
+/**
+  * The benchmark function is used to measure the throughput of the
+  * nextbuf method, and the next method, over the given number of
+  * megabytes.
+  */
+static void
+benchmark(const srecord::crc16 &prototype, long megabytes)
+{
+    std::vector<unsigned char> buffer(1 << 20);
+    fill_random(buffer);
+    typedef std::chrono::steady_clock clock;
+
+    srecord::crc16 fast(prototype);
+    clock::time_point t0 = clock::now();
+    for (long j = 0; j < megabytes; ++j)
+        fast.nextbuf(buffer.data(), buffer.size());
+    clock::time_point t1 = clock::now();
+
+    srecord::crc16 slow(prototype);
+    for (long j = 0; j < megabytes; ++j)
+    {
+        for (unsigned char c : buffer)
+            slow.next(c);
+    }
+    clock::time_point t2 = clock::now();
+
+    double fast_secs = std::chrono::duration<double>(t1 - t0).count();
+    double slow_secs = std::chrono::duration<double>(t2 - t1).count();
+    printf
+    (
+        "nextbuf: %.1f MB/s, next: %.1f MB/s (0x%04X, 0x%04X)\n",
+        megabytes / (fast_secs > 0 ? fast_secs : 1e-9),
+        megabytes / (slow_secs > 0 ? slow_secs : 1e-9),
+        fast.get(),
+        slow.get()
+    );
+}
+
+
 int
 main(int argc, char **argv)
 {
@@ -61,9 +169,11 @@ main(int argc, char **argv)
     srecord::crc16::bit_direction_t bitdir =
         srecord::crc16::bit_direction_most_to_least;
     bool h_flag = false;
+    bool check_flag = false;
+    long bench_megabytes = 0;
     for (;;)
     {
-        int c = getopt_long(argc, argv, "abchp:rtVx", options, 0);
+        int c = getopt_long(argc, argv, "aB:bchkp:rtVx", options, 0);
         if (c == EOF)
             break;
         switch (c)
@@ -72,6 +182,12 @@ main(int argc, char **argv)
             augment = !augment;
             break;
 
+        case 'B':
+            bench_megabytes = strtol(optarg, 0, 0);
+            if (bench_megabytes <= 0)
+                usage();
+            break;
+
         case 'b':
             seed_mode = srecord::crc16::seed_mode_broken;
             break;
@@ -84,6 +200,10 @@ main(int argc, char **argv)
             h_flag = true;
             break;
 
+        case 'k':
+            check_flag = true;
+            break;
+
         case 'p':
             {
                 char *ep = 0;
@@ -123,6 +243,13 @@ main(int argc, char **argv)
         check.print_table();
         return 0;
     }
+    if (check_flag)
+        return ::check(check);
+    if (bench_megabytes)
+    {
+        benchmark(check, bench_megabytes);
+        return 0;
+    }
     for (;;)
     {
         char buffer[1024];